@@ -0,0 +1,215 @@
+/**
+ * @file AckFifo.hpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <initializer_list>
+#include <span>
+#include <utility>
+
+/**
+ * @brief FIFO with acknowledged consumption, for at-least-once delivery.
+ * Elements pulled from the FIFO stay in place, "in flight", until they are acknowledged: ack()
+ * frees them and nack() makes them available again for redelivery. Three cursors are kept:
+ * write, read and ack. Space for new elements is only freed by ack().
+ * This FIFO does NOT support access from concurrent threads.
+ */
+template <typename T, size_t t_size>
+class AckFifo {
+  public:
+    /**
+     * @brief Get current number of elements to be read in the FIFO buffer
+     * @return Number of elements
+     */
+    size_t getCount() const { return m_nbElements - m_nbInFlight; }
+
+    /**
+     * @brief Get current number of elements read and not acknowledged yet
+     * @return Number of elements
+     */
+    size_t getInFlight() const { return m_nbInFlight; }
+
+    /**
+     * @brief Get current number of free slots, slots of in-flight elements are not free
+     * @return Number of elements that can be pushed
+     */
+    size_t getFreeSpace() const { return t_size - m_nbElements; }
+
+    /**
+     * @brief Empty the FIFO, delete all the data, in flight or not
+     */
+    void reset() {
+        m_ackIdx = 0;
+        m_readIdx = 0;
+        m_writeIdx = 0;
+        m_nbElements = 0;
+        m_nbInFlight = 0;
+    }
+
+    /**
+     * @brief Write data to the FIFO. If there is not enough space, leave the FIFO as is.
+     * @param[in] src Source buffer to copy the data from
+     * @return Number of elements copied in the FIFO
+     */
+    size_t push(std::span<const T> src) {
+        if (src.size() > getFreeSpace()) {
+            return 0;
+        }
+
+        const auto first = std::min(src.size(), t_size - m_writeIdx);
+        std::copy_n(src.begin(), first, m_buffer.begin() + m_writeIdx);
+        std::copy(src.begin() + first, src.end(), m_buffer.begin());
+
+        m_writeIdx = (m_writeIdx + src.size()) % t_size;
+        m_nbElements += src.size();
+
+        return src.size();
+    }
+
+    /**
+     * @brief Write data to the FIFO. If there is not enough space, leave the FIFO as is.
+     * @param[in] src Initializer list containing elements to push to the FIFO
+     * @return Number of elements copied in the FIFO
+     */
+    size_t push(const std::initializer_list<T> &src) {
+        return push(std::span<const T>{src.begin(), src.size()});
+    }
+
+    /**
+     * @brief Write a single sample it the FIFO.
+     * @param[in] sample to write
+     * @return True if the sample was written, otherwise false.
+     */
+    bool push(T var) {
+        if (m_nbElements == t_size) {
+            return false;
+        }
+
+        m_buffer[m_writeIdx] = std::move(var);
+        m_writeIdx = (m_writeIdx + 1) % t_size;
+        m_nbElements++;
+
+        return true;
+    }
+
+    /**
+     * @brief Read the first unread element, which becomes in flight
+     * @param[out] dest Where the element is copied
+     * @return True if reading is done, otherwise false
+     */
+    bool pop(T *const dest) { return (pull(dest, 1) != 0); }
+
+    /**
+     * @brief Read data from the FIFO. Read elements become in flight, they stay in the FIFO until
+     * acknowledged.
+     * @param[out] dest Destination buffer where the data are written to
+     * @param[in] availSpace Available space in the destination buffer, in elements
+     * @return Number of elements read
+     */
+    size_t pull(T *destination, size_t availSpace) {
+        assert(destination != nullptr);
+
+        const auto nbElementsToCopy = std::min(availSpace, getCount());
+        const auto first = std::min(nbElementsToCopy, t_size - m_readIdx);
+
+        std::copy_n(m_buffer.begin() + m_readIdx, first, destination);
+        std::copy_n(m_buffer.begin(), nbElementsToCopy - first, destination + first);
+
+        m_readIdx = (m_readIdx + nbElementsToCopy) % t_size;
+        m_nbInFlight += nbElementsToCopy;
+
+        return nbElementsToCopy;
+    }
+
+    /**
+     * @brief Acknowledge the oldest in-flight elements, their slots are freed
+     * @param[in] size Number of elements to acknowledge
+     * @return Number of elements acknowledged
+     */
+    size_t ack(size_t size) {
+        const auto nbAcked = std::min(size, m_nbInFlight);
+
+        m_ackIdx = (m_ackIdx + nbAcked) % t_size;
+        m_nbInFlight -= nbAcked;
+        m_nbElements -= nbAcked;
+
+        return nbAcked;
+    }
+
+    /**
+     * @brief Acknowledge all the in-flight elements
+     * @return Number of elements acknowledged
+     */
+    size_t ackAll() { return ack(m_nbInFlight); }
+
+    /**
+     * @brief Reject all the in-flight elements: the read cursor goes back to the ack cursor and
+     * they will be read again, in the same order.
+     * @return Number of elements to be redelivered
+     */
+    size_t nack() {
+        const auto nbRejected = m_nbInFlight;
+
+        m_readIdx = m_ackIdx;
+        m_nbInFlight = 0;
+
+        return nbRejected;
+    }
+
+  private:
+    /**
+     * @brief Container where the FIFO elements are stored
+     */
+    std::array<T, t_size> m_buffer{};
+
+    /**
+     * @brief Ack index, oldest element not acknowledged yet
+     */
+    size_t m_ackIdx{0U};
+
+    /**
+     * @brief Current read index, where the next data to read is
+     */
+    size_t m_readIdx{0U};
+
+    /**
+     * @brief Write index, index where to write the next data
+     */
+    size_t m_writeIdx{0U};
+
+    /**
+     * @brief Current nb of elements in the FIFO, in flight or not
+     */
+    size_t m_nbElements{0U};
+
+    /**
+     * @brief Current nb of elements read and not acknowledged
+     */
+    size_t m_nbInFlight{0U};
+};
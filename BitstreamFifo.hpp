@@ -0,0 +1,249 @@
+/**
+ * @file BitstreamFifo.hpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include "FIFO.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <optional>
+
+/**
+ * @brief Bit-granular FIFO, for fields of 1 to 32 bits such as codec syntax elements.
+ * Bits are stored MSB first in a byte FIFO of t_size bytes. Each side keeps a 64-bit
+ * accumulator: put_bits() only shifts into the write accumulator, which is flushed to the ring
+ * 32 bits at a time, and get_bits()/peek_bits() only shift out of the read accumulator, which is
+ * refilled from the ring 32 bits at a time. Bits still in the write accumulator are readable.
+ * This FIFO does NOT support access from concurrent threads.
+ */
+template <size_t t_size>
+class BitstreamFifo {
+  public:
+    /**
+     * @brief Maximum width of a single field, in bits
+     */
+    static constexpr unsigned s_maxBits{32U};
+
+    /**
+     * @brief Get current number of bits to be read
+     * @return Number of bits
+     */
+    size_t getCount() const { return m_readBits + m_bytes.getCount() * 8U + m_writeBits; }
+
+    /**
+     * @brief Get current number of bits that can be written
+     * @return Number of bits
+     */
+    size_t getFreeSpace() const { return (t_size - m_bytes.getCount()) * 8U - m_writeBits; }
+
+    /**
+     * @brief Empty the FIFO, delete all the data
+     */
+    void reset() {
+        m_bytes.reset();
+        m_writeAcc = 0U;
+        m_writeBits = 0U;
+        m_readAcc = 0U;
+        m_readBits = 0U;
+        m_writeOffset = 0U;
+    }
+
+    /**
+     * @brief Write a field to the FIFO. If there is not enough space, leave the FIFO as is.
+     * @param[in] value Field value, only its nbits low bits are written
+     * @param[in] nbits Field width, from 1 to 32 bits
+     * @return True if the field was written, otherwise false
+     */
+    bool put_bits(uint32_t value, unsigned nbits) {
+        assert(nbits > 0U && nbits <= s_maxBits);
+
+        if (nbits > getFreeSpace()) {
+            return false;
+        }
+
+        m_writeAcc = (m_writeAcc << nbits) | (value & mask(nbits));
+        m_writeBits += nbits;
+        m_writeOffset = (m_writeOffset + nbits) % 8U;
+
+        if (m_writeBits >= 32U) {
+            // The free space check guarantees the ring can take the pending bits
+            m_writeBits -= 32U;
+            const auto word = static_cast<uint32_t>(m_writeAcc >> m_writeBits);
+            m_writeAcc &= mask(m_writeBits);
+            m_bytes.push(std::array<uint8_t, 4>{
+                static_cast<uint8_t>(word >> 24U), static_cast<uint8_t>(word >> 16U),
+                static_cast<uint8_t>(word >> 8U), static_cast<uint8_t>(word)});
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Pad the written bits with zeros up to the next byte boundary, e.g. at the end of a
+     * packet
+     * @return Number of padding bits written
+     */
+    unsigned flush() {
+        const auto padding = (8U - m_writeOffset) % 8U;
+
+        if (padding != 0U && padding <= getFreeSpace()) {
+            put_bits(0U, padding);
+            return padding;
+        }
+
+        return 0U;
+    }
+
+    /**
+     * @brief Read a field from the FIFO
+     * @param[in] nbits Field width, from 1 to 32 bits
+     * @return Field value, nothing if less than nbits bits are available
+     */
+    std::optional<uint32_t> get_bits(unsigned nbits) {
+        assert(nbits > 0U && nbits <= s_maxBits);
+
+        if (nbits > getCount()) {
+            return std::nullopt;
+        }
+
+        refill(nbits);
+        const auto value = static_cast<uint32_t>(m_readAcc >> (64U - nbits));
+        consume(nbits);
+
+        return value;
+    }
+
+    /**
+     * @brief Read the next bits without removing them, for table-driven decoding. If less than
+     * nbits bits are available, the missing low bits are zero.
+     * @param[in] nbits Number of bits to look at, from 1 to 32
+     * @return Next nbits bits
+     */
+    uint32_t peek_bits(unsigned nbits) {
+        assert(nbits > 0U && nbits <= s_maxBits);
+
+        refill(nbits);
+        return static_cast<uint32_t>(m_readAcc >> (64U - nbits));
+    }
+
+    /**
+     * @brief Remove bits from the FIFO, e.g. the length of a code found with peek_bits()
+     * @param[in] nbits Number of bits to remove
+     * @return Number of bits removed
+     */
+    size_t skip_bits(size_t nbits) {
+        nbits = std::min(nbits, getCount());
+
+        for (auto left = nbits; left != 0U;) {
+            const auto chunk = static_cast<unsigned>(std::min<size_t>(left, s_maxBits));
+            refill(chunk);
+            consume(chunk);
+            left -= chunk;
+        }
+
+        return nbits;
+    }
+
+  private:
+    /**
+     * @brief Mask of the n low bits
+     * @param[in] nbits Number of bits, up to 63
+     */
+    static constexpr uint64_t mask(unsigned nbits) { return (uint64_t{1} << nbits) - 1U; }
+
+    /**
+     * @brief Make sure the read accumulator holds at least nbits bits, if available
+     * @param[in] nbits Number of bits needed, up to 32
+     */
+    void refill(unsigned nbits) {
+        std::array<uint8_t, 4> word{};
+
+        while (m_readBits <= 32U && m_bytes.pull(word) != 0U) {
+            m_readAcc |= static_cast<uint64_t>((uint32_t{word[0]} << 24U) | (uint32_t{word[1]} << 16U) |
+                                               (uint32_t{word[2]} << 8U) | uint32_t{word[3]})
+                          << (32U - m_readBits);
+            m_readBits += 32U;
+        }
+
+        uint8_t byte;
+        while (m_readBits <= 56U && m_readBits < nbits && m_bytes.pop(&byte)) {
+            m_readAcc |= static_cast<uint64_t>(byte) << (56U - m_readBits);
+            m_readBits += 8U;
+        }
+
+        if (m_readBits < nbits && m_bytes.getCount() == 0U && m_writeBits != 0U) {
+            // The ring is drained, the newest bits are still in the write accumulator
+            m_readAcc |= m_writeAcc << (64U - m_readBits - m_writeBits);
+            m_readBits += m_writeBits;
+            m_writeAcc = 0U;
+            m_writeBits = 0U;
+        }
+    }
+
+    /**
+     * @brief Remove bits from the read accumulator
+     * @param[in] nbits Number of bits, up to 32 and at most the accumulator content
+     */
+    void consume(unsigned nbits) {
+        assert(nbits <= m_readBits);
+
+        m_readAcc <<= nbits;
+        m_readBits -= nbits;
+    }
+
+    /**
+     * @brief Ring where the complete bytes are stored
+     */
+    Fifo<uint8_t, t_size> m_bytes{};
+
+    /**
+     * @brief Bits written and not flushed to the ring yet, right aligned
+     */
+    uint64_t m_writeAcc{0U};
+
+    /**
+     * @brief Number of bits in the write accumulator, always below 32 between calls
+     */
+    unsigned m_writeBits{0U};
+
+    /**
+     * @brief Bits taken from the ring and not read yet, left aligned
+     */
+    uint64_t m_readAcc{0U};
+
+    /**
+     * @brief Number of bits in the read accumulator
+     */
+    unsigned m_readBits{0U};
+
+    /**
+     * @brief Position of the write cursor within its byte, in bits
+     */
+    unsigned m_writeOffset{0U};
+};
@@ -0,0 +1,207 @@
+/**
+ * @file BufferExchange.hpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include "FIFO.hpp"
+#include "SpinLock.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+/**
+ * @brief Fixed set of buffers circulating between a producer and a consumer thread through two
+ * Fifo of indices: a "full" ring from the producer to the consumer and a "free" ring back.
+ * Buffers are handed out as move-only leases: a lease is either submitted, released, or given
+ * back to the free ring when destroyed, so a buffer can neither be lost nor released twice.
+ * Each ring is guarded by a spin lock, the buffers themselves are never copied.
+ */
+template <typename Buffer, size_t t_count>
+class BufferExchange {
+    static_assert(t_count <= UINT32_MAX, "Too many buffers for 32-bit indices");
+
+  public:
+    using Index = uint32_t;
+
+    /**
+     * @brief Exclusive access to one buffer of the exchange
+     */
+    class Lease {
+      public:
+        /**
+         * @brief Construct an empty lease
+         */
+        Lease() = default;
+
+        Lease(const Lease &) = delete;
+        Lease &operator=(const Lease &) = delete;
+
+        Lease(Lease &&other) noexcept
+            : m_exchange(std::exchange(other.m_exchange, nullptr)), m_index(other.m_index) {}
+
+        Lease &operator=(Lease &&other) noexcept {
+            if (this != &other) {
+                giveBack();
+                m_exchange = std::exchange(other.m_exchange, nullptr);
+                m_index = other.m_index;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief A buffer still leased is given back to the free ring
+         */
+        ~Lease() { giveBack(); }
+
+        /// @brief True if the lease holds a buffer
+        explicit operator bool() const { return m_exchange != nullptr; }
+
+        /// @brief Access to the leased buffer, the lease shall not be empty
+        Buffer &operator*() const {
+            assert(m_exchange != nullptr);
+            return m_exchange->m_buffers[m_index];
+        }
+
+        /// @brief Access to the leased buffer, the lease shall not be empty
+        Buffer *operator->() const { return &**this; }
+
+      private:
+        friend class BufferExchange;
+
+        Lease(BufferExchange *exchange, Index index) : m_exchange(exchange), m_index(index) {}
+
+        Index take() {
+            assert(m_exchange != nullptr);
+            m_exchange = nullptr;
+            return m_index;
+        }
+
+        void giveBack() {
+            if (m_exchange != nullptr) {
+                auto *exchange = m_exchange;
+                exchange->pushIndex(exchange->m_free, exchange->m_freeLock, take());
+            }
+        }
+
+        BufferExchange *m_exchange{nullptr};
+        Index m_index{0U};
+    };
+
+    /**
+     * @brief Construct a new BufferExchange object, all the buffers are free
+     */
+    BufferExchange() {
+        for (size_t i = 0; i < t_count; i++) {
+            m_free.push(static_cast<Index>(i));
+        }
+    }
+
+    BufferExchange(const BufferExchange &) = delete;
+    BufferExchange &operator=(const BufferExchange &) = delete;
+
+    /**
+     * @brief Producer side: lease a free buffer
+     * @return A lease on a free buffer, empty if all the buffers are in use
+     */
+    Lease acquire() { return popIndex(m_free, m_freeLock); }
+
+    /**
+     * @brief Producer side: hand a filled buffer to the consumer
+     * @param[in] lease Lease on the filled buffer, left empty. An empty lease or a lease from
+     * another exchange is rejected and left as is.
+     * @return True if the buffer was submitted, otherwise false
+     */
+    bool submit(Lease &&lease) {
+        if (lease.m_exchange != this) {
+            return false;
+        }
+
+        pushIndex(m_full, m_fullLock, lease.take());
+        return true;
+    }
+
+    /**
+     * @brief Consumer side: lease the oldest filled buffer
+     * @return A lease on a filled buffer, empty if no buffer was submitted
+     */
+    Lease receive() { return popIndex(m_full, m_fullLock); }
+
+    /**
+     * @brief Consumer side: give a processed buffer back to the producer
+     * @param[in] lease Lease on the processed buffer, left empty. An empty lease or a lease from
+     * another exchange is rejected and left as is.
+     * @return True if the buffer was released, otherwise false
+     */
+    bool release(Lease &&lease) {
+        if (lease.m_exchange != this) {
+            return false;
+        }
+
+        lease.giveBack();
+        return true;
+    }
+
+  private:
+    Lease popIndex(Fifo<Index, t_count> &ring, SpinLock &lock) {
+        Index index;
+        std::lock_guard guard(lock);
+        return ring.pop(&index) ? Lease(this, index) : Lease();
+    }
+
+    void pushIndex(Fifo<Index, t_count> &ring, SpinLock &lock, Index index) {
+        std::lock_guard guard(lock);
+        // cannot fail: each ring can hold all the buffers
+        ring.push(index);
+    }
+
+    /**
+     * @brief Buffers owned by the exchange
+     */
+    std::array<Buffer, t_count> m_buffers{};
+
+    /**
+     * @brief Indices of the buffers ready to be filled
+     */
+    Fifo<Index, t_count> m_free{};
+
+    /**
+     * @brief Indices of the buffers filled and not received yet
+     */
+    Fifo<Index, t_count> m_full{};
+
+    /**
+     * @brief Guards the free ring
+     */
+    SpinLock m_freeLock{};
+
+    /**
+     * @brief Guards the full ring
+     */
+    SpinLock m_fullLock{};
+};
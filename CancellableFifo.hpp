@@ -0,0 +1,240 @@
+/**
+ * @file CancellableFifo.hpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief FIFO whose entries can be cancelled after being pushed. push() returns a handle made of
+ * the slot index and a generation counter; cancel() turns the entry into a tombstone in O(1).
+ * Tombstones are skipped by pop() and pull() using a per-slot bitmap, a whole word at a time.
+ * @note A tombstone keeps its slot until the read index reaches it.
+ * This FIFO does NOT support access from concurrent threads.
+ */
+template <typename T, size_t t_size>
+class CancellableFifo {
+    static_assert(t_size <= UINT32_MAX, "FIFO too large for 32-bit slot indices");
+
+  public:
+    /**
+     * @brief Handle of a pushed entry, only valid for the entry it was returned for
+     */
+    struct Handle {
+        uint32_t index;
+        uint32_t generation;
+    };
+
+    /**
+     * @brief Get current number of live entries, tombstones excluded
+     * @return Number of elements
+     */
+    size_t getCount() const { return m_nbElements - m_nbTombstones; }
+
+    /**
+     * @brief Get current number of cancelled entries still taking a slot
+     * @return Number of tombstones
+     */
+    size_t getTombstones() const { return m_nbTombstones; }
+
+    /**
+     * @brief Get current number of slots in use, by live entries or tombstones
+     * @return Number of slots
+     */
+    size_t getOccupancy() const { return m_nbElements; }
+
+    /**
+     * @brief Empty the FIFO, delete all the data. Existing handles become invalid.
+     */
+    void reset() {
+        while (m_nbElements > 0) {
+            release(m_readIdx);
+            m_readIdx = (m_readIdx + 1) % t_size;
+            --m_nbElements;
+        }
+        m_tombstones.fill(0U);
+        m_readIdx = 0;
+        m_writeIdx = 0;
+        m_nbTombstones = 0;
+    }
+
+    /**
+     * @brief Write a single sample in the FIFO
+     * @param[in] sample to write
+     * @return Handle to cancel the entry, or nothing if the FIFO is full
+     */
+    std::optional<Handle> push(T var) {
+        skipTombstones();
+
+        if (m_nbElements == t_size) {
+            return std::nullopt;
+        }
+
+        const auto index = m_writeIdx;
+        m_buffer[index] = std::move(var);
+        m_generations[index]++;
+        m_writeIdx = (m_writeIdx + 1) % t_size;
+        m_nbElements++;
+
+        return Handle{static_cast<uint32_t>(index), m_generations[index]};
+    }
+
+    /**
+     * @brief Cancel an entry: it will never be read
+     * @param[in] handle Handle returned when the entry was pushed
+     * @return True if the entry was cancelled, false if it was already read, cancelled, or
+     * the handle is not valid
+     */
+    bool cancel(Handle handle) {
+        const size_t index = handle.index;
+
+        if ((index >= t_size) || (m_generations[index] != handle.generation) ||
+            (((index + t_size - m_readIdx) % t_size) >= m_nbElements) || isTombstone(index)) {
+            return false;
+        }
+
+        m_tombstones[index / 64U] |= (uint64_t{1} << (index % 64U));
+        m_nbTombstones++;
+        release(index);
+
+        return true;
+    }
+
+    /**
+     * @brief Pull the first live element from the FIFO
+     * @param[out] dest Where the element is moved to
+     * @return True if reading is done, otherwise false
+     */
+    bool pop(T *const dest) { return (pull(dest, 1) != 0); }
+
+    /**
+     * @brief Read live elements from the FIFO and delete them, skipping tombstones
+     * @param[out] dest Destination buffer where the data are moved to
+     * @param[in] availSpace Available space in the destination buffer, in elements
+     * @return Number of elements read
+     */
+    size_t pull(T *destination, size_t availSpace) {
+        assert(destination != nullptr);
+        size_t nbRead = 0U;
+
+        while (nbRead < availSpace) {
+            skipTombstones();
+
+            if (m_nbElements == 0) {
+                break;
+            }
+
+            // run of live entries, up to the next tombstone or the end of the bitmap word
+            const auto bit = m_readIdx % 64U;
+            const auto word = m_tombstones[m_readIdx / 64U] >> bit;
+            const auto maxRun = std::min({availSpace - nbRead, m_nbElements, 64U - bit, t_size - m_readIdx});
+            const auto run = std::min<size_t>(static_cast<size_t>(std::countr_zero(word)), maxRun);
+
+            std::move(m_buffer.begin() + m_readIdx, m_buffer.begin() + m_readIdx + run, destination + nbRead);
+
+            m_readIdx = (m_readIdx + run) % t_size;
+            m_nbElements -= run;
+            nbRead += run;
+        }
+
+        return nbRead;
+    }
+
+  private:
+    bool isTombstone(size_t index) const { return ((m_tombstones[index / 64U] >> (index % 64U)) & 1U) != 0U; }
+
+    void release(size_t index) {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            m_buffer[index] = T{};
+        }
+    }
+
+    /**
+     * @brief Move the read index past the tombstones at the head of the FIFO, a bitmap word at a
+     * time
+     */
+    void skipTombstones() {
+        while ((m_nbTombstones > 0) && (m_nbElements > 0)) {
+            const auto bit = m_readIdx % 64U;
+            auto &word = m_tombstones[m_readIdx / 64U];
+            const auto maxRun = std::min({m_nbElements, 64U - bit, t_size - m_readIdx});
+            const auto run = std::min<size_t>(static_cast<size_t>(std::countr_one(word >> bit)), maxRun);
+
+            if (run == 0) {
+                break;
+            }
+
+            const auto mask = (run == 64U) ? ~uint64_t{0} : (((uint64_t{1} << run) - 1U) << bit);
+            word &= ~mask;
+
+            m_readIdx = (m_readIdx + run) % t_size;
+            m_nbElements -= run;
+            m_nbTombstones -= run;
+        }
+    }
+
+    /**
+     * @brief Container where the FIFO elements are stored
+     */
+    std::array<T, t_size> m_buffer{};
+
+    /**
+     * @brief Generation of each slot, incremented on each push in the slot
+     */
+    std::array<uint32_t, t_size> m_generations{};
+
+    /**
+     * @brief One bit per slot, set when the entry of the slot is cancelled
+     */
+    std::array<uint64_t, (t_size + 63U) / 64U> m_tombstones{};
+
+    /**
+     * @brief Current read index, where the next data to read is
+     */
+    size_t m_readIdx{0U};
+
+    /**
+     * @brief Write index, index where to write the next data
+     */
+    size_t m_writeIdx{0U};
+
+    /**
+     * @brief Current nb of slots in use, by live entries or tombstones
+     */
+    size_t m_nbElements{0U};
+
+    /**
+     * @brief Current nb of tombstones
+     */
+    size_t m_nbTombstones{0U};
+};
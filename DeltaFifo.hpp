@@ -0,0 +1,265 @@
+/**
+ * @file DeltaFifo.hpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include "FIFO.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+/**
+ * @brief Compressed FIFO for slowly varying integers, such as counters or timestamps. Each element
+ * is stored as the difference with the previous one, zigzag encoded so small negative differences
+ * stay small, as a LEB128 varint in a byte FIFO of t_size bytes: differences below 64 in absolute
+ * value take a single byte instead of sizeof(T).
+ * The capacity depends on the data, getFreeSpace() is in bytes.
+ * This FIFO does NOT support access from concurrent threads.
+ */
+template <typename T, size_t t_size>
+class DeltaFifo {
+    static_assert(std::is_integral_v<T> && sizeof(T) <= sizeof(uint64_t), "Elements must be integers up to 64 bits");
+
+  public:
+    /**
+     * @brief Maximum size of an encoded element, in bytes
+     */
+    static constexpr size_t s_maxEncodedSize{10U};
+
+    /**
+     * @brief Get current number of elements in the FIFO
+     * @return Number of elements
+     */
+    size_t getCount() const { return m_nbElements; }
+
+    /**
+     * @brief Get current size of the encoded elements
+     * @return Number of bytes used
+     */
+    size_t getUsedBytes() const { return m_bytes.getCount(); }
+
+    /**
+     * @brief Get current free space
+     * @return Number of free bytes
+     */
+    size_t getFreeSpace() const { return t_size - m_bytes.getCount(); }
+
+    /**
+     * @brief Empty the FIFO, delete all the data
+     */
+    void reset() {
+        m_bytes.reset();
+        m_nbElements = 0;
+        m_lastPushed = 0;
+        m_lastPulled = 0;
+    }
+
+    /**
+     * @brief Write a single element to the FIFO
+     * @param[in] var Element to write
+     * @return True if the element was written, otherwise false
+     */
+    bool push(T var) { return (push(std::span<const T>{&var, 1U}) != 0); }
+
+    /**
+     * @brief Write data to the FIFO. If there is not enough space, leave the FIFO as is.
+     * @param[in] src Source buffer to encode the data from
+     * @return Number of elements written
+     */
+    size_t push(std::span<const T> src) {
+        auto prev = m_lastPushed;
+        size_t nbBytes = 0;
+        for (const auto var : src) {
+            nbBytes += encodedSize(zigzag(widen(var) - prev));
+            prev = widen(var);
+        }
+
+        if (nbBytes > getFreeSpace()) {
+            return 0;
+        }
+
+        const auto [first, second] = m_bytes.write_span(nbBytes);
+        std::array<uint8_t, s_maxEncodedSize> tmp{};
+        size_t pos = 0;
+
+        for (const auto var : src) {
+            const auto value = zigzag(widen(var) - m_lastPushed);
+            m_lastPushed = widen(var);
+
+            if (pos + s_maxEncodedSize <= first.size()) {
+                pos += encode(value, first.data() + pos);
+            } else {
+                // Close to the end of the ring, the element may wrap
+                const auto size = encode(value, tmp.data());
+                for (size_t i = 0; i < size; i++, pos++) {
+                    (pos < first.size() ? first[pos] : second[pos - first.size()]) = tmp[i];
+                }
+            }
+        }
+
+        m_bytes.commit(nbBytes);
+        m_nbElements += src.size();
+
+        return src.size();
+    }
+
+    /**
+     * @brief Read and remove the oldest element
+     * @param[out] dest Where the element is written
+     * @return True if an element was read, otherwise false
+     */
+    bool pop(T *const dest) { return (pull(dest, 1) != 0); }
+
+    /**
+     * @brief Read data from the FIFO
+     * @param[out] destination Destination buffer where the data are decoded to
+     * @param[in] availSpace Available space in the destination buffer, in elements
+     * @return Number of elements read
+     */
+    size_t pull(T *destination, size_t availSpace) {
+        assert(destination != nullptr);
+
+        const auto nbElements = std::min(availSpace, m_nbElements);
+        const auto [first, second] = m_bytes.peek_span(0U, m_bytes.getCount());
+        auto prev = m_lastPulled;
+        size_t pos = 0;
+        size_t i = 0;
+
+        while (i < nbElements) {
+            if (uint64_t word; pos + sizeof(word) <= first.size() && nbElements - i >= sizeof(word)) {
+                std::memcpy(&word, first.data() + pos, sizeof(word));
+                if ((word & s_continuationBits) == 0U) {
+                    // 8 single-byte elements in a row, the common case for slowly varying data
+                    for (size_t k = 0; k < sizeof(word); k++) {
+                        prev += unzigzag(first[pos + k]);
+                        destination[i + k] = static_cast<T>(prev);
+                    }
+                    pos += sizeof(word);
+                    i += sizeof(word);
+                    continue;
+                }
+            }
+
+            uint64_t value = 0;
+            uint8_t byte;
+            unsigned shift = 0;
+            do {
+                byte = (pos < first.size()) ? first[pos] : second[pos - first.size()];
+                value |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+                shift += 7U;
+                pos++;
+            } while ((byte & 0x80U) != 0U);
+
+            prev += unzigzag(value);
+            destination[i++] = static_cast<T>(prev);
+        }
+
+        m_bytes.drop(pos);
+        m_lastPulled = prev;
+        m_nbElements -= nbElements;
+
+        return nbElements;
+    }
+
+  private:
+    /**
+     * @brief Continuation bit of each byte of a 64-bit word
+     */
+    static constexpr uint64_t s_continuationBits{0x8080808080808080U};
+
+    /**
+     * @brief Convert an element to 64 bits, differences are computed modulo 2^64
+     * @param[in] var Element
+     */
+    static constexpr uint64_t widen(T var) {
+        if constexpr (std::is_signed_v<T>) {
+            return static_cast<uint64_t>(static_cast<int64_t>(var));
+        } else {
+            return static_cast<uint64_t>(var);
+        }
+    }
+
+    /**
+     * @brief Map a difference to an unsigned value, small in absolute value means small
+     * @param[in] delta Difference, as a two's complement 64-bit value
+     */
+    static constexpr uint64_t zigzag(uint64_t delta) {
+        return (delta << 1U) ^ (0U - (delta >> 63U));
+    }
+
+    /// @brief Inverse of zigzag()
+    static constexpr uint64_t unzigzag(uint64_t value) { return (value >> 1U) ^ (0U - (value & 1U)); }
+
+    /**
+     * @brief Get the size of an encoded value
+     * @param[in] value Zigzag encoded value
+     */
+    static constexpr size_t encodedSize(uint64_t value) {
+        return 1U + static_cast<size_t>(std::max(0, 63 - std::countl_zero(value | 1U)) / 7);
+    }
+
+    /**
+     * @brief Encode a value as a varint, 7 bits per byte with the high bit set if more follow
+     * @param[in] value Zigzag encoded value
+     * @param[out] dest Where the bytes are written, s_maxEncodedSize bytes must be available
+     * @return Number of bytes written
+     */
+    static size_t encode(uint64_t value, uint8_t *dest) {
+        size_t size = 0;
+        while (value >= 0x80U) {
+            dest[size++] = static_cast<uint8_t>(value | 0x80U);
+            value >>= 7U;
+        }
+        dest[size++] = static_cast<uint8_t>(value);
+        return size;
+    }
+
+    /**
+     * @brief Ring where the encoded elements are stored
+     */
+    Fifo<uint8_t, t_size> m_bytes{};
+
+    /**
+     * @brief Current number of elements in the FIFO
+     */
+    size_t m_nbElements{0U};
+
+    /**
+     * @brief Last element written, base of the next difference
+     */
+    uint64_t m_lastPushed{0U};
+
+    /**
+     * @brief Last element read, base of the next decoded difference
+     */
+    uint64_t m_lastPulled{0U};
+};
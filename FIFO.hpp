@@ -24,10 +24,22 @@
  *
  */
 
+#pragma once
+
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <ranges>
 #include <span>
+#include <type_traits>
+#include <utility>
 
 /**
  * @brief FIFO class push and pull data from a static container.
@@ -40,7 +52,7 @@ class Fifo {
     /**
      * @brief Construct a new Fifo object
      */
-    Fifo() : m_readIdx(0), m_writeIdx(0), m_nbElements(0) {}
+    Fifo() : m_buffer{}, m_readIdx(0), m_writeIdx(0), m_nbElements(0) {}
 
     /**
      * @brief Construct a new Fifo object
@@ -58,6 +70,64 @@ class Fifo {
         }
     }
 
+    /**
+     * @brief Copy constructor, only the elements in the FIFO are copied, in at most two bulk
+     * copies. The copy is linearized: its elements start at the beginning of its container.
+     * The container is default-initialized rather than value-initialized, so for trivial types
+     * the free slots are left uninitialized instead of being zero-filled.
+     */
+    Fifo(const Fifo &other)
+        requires std::is_copy_assignable_v<T>
+    {
+        assignFrom(other);
+    }
+
+    /**
+     * @brief Move constructor, only the elements in the FIFO are moved. The moved-from FIFO is
+     * left empty. As for the copy constructor, the free slots are not value-initialized.
+     */
+    Fifo(Fifo &&other) noexcept(s_nothrowMove) { assignFrom(std::move(other)); }
+
+    /**
+     * @brief Construct a new Fifo object from a FIFO of another capacity. If the other FIFO holds
+     * more elements than this capacity, only the last ones are kept. As for the copy constructor,
+     * the free slots are not value-initialized.
+     * @param[in] other FIFO to copy the elements from
+     */
+    template <size_t t_otherSize>
+        requires std::is_copy_assignable_v<T>
+    explicit Fifo(const Fifo<T, t_otherSize> &other) {
+        assignFrom(other);
+    }
+
+    /**
+     * @brief Construct a new Fifo object from a FIFO of another capacity, see above. The
+     * moved-from FIFO is left empty.
+     * @param[in] other FIFO to move the elements from
+     */
+    template <size_t t_otherSize>
+    explicit Fifo(Fifo<T, t_otherSize> &&other) {
+        assignFrom(std::move(other));
+    }
+
+    /// @brief Copy assignment, only the elements in the FIFO are copied
+    Fifo &operator=(const Fifo &other)
+        requires std::is_copy_assignable_v<T>
+    {
+        if (this != &other) {
+            assignFrom(other);
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment, only the elements in the FIFO are moved
+    Fifo &operator=(Fifo &&other) noexcept(s_nothrowMove) {
+        if (this != &other) {
+            assignFrom(std::move(other));
+        }
+        return *this;
+    }
+
     /**
      * @brief Get current number of elements to be read in the FIFO buffer
      * @return Number of elements
@@ -65,9 +135,23 @@ class Fifo {
     size_t getCount() const { return m_nbElements; }
 
     /**
-     * @brief Empty the FIFO, delete all the data
+     * @brief Get the sequence number of the oldest element still in the FIFO. Each written element
+     * gets the next 64-bit sequence number, starting from 0.
+     * @return Sequence number of the first element to be read
+     */
+    uint64_t getFirstSequence() const { return m_nextSeq - m_nbElements; }
+
+    /**
+     * @brief Get the sequence number the next written element will get
+     * @return Sequence number of the next element
+     */
+    uint64_t getNextSequence() const { return m_nextSeq; }
+
+    /**
+     * @brief Empty the FIFO, delete all the data. Sequence numbers are not reset.
      */
-    void reset() {
+    void reset() noexcept(s_nothrowMove) {
+        releaseSlots(m_readIdx, m_nbElements);
         m_writeIdx = 0;
         m_readIdx = 0;
         m_nbElements = 0;
@@ -78,12 +162,13 @@ class Fifo {
      * @param[out] dest Where a single byte from the FIFO is written
      * @return True if reading is done, otherwise false
      */
-    bool pop(T *const dest) {
+    bool pop(T *const dest) noexcept(s_nothrowMove) {
         auto ret = true;
         assert(dest != nullptr);
 
         if (m_nbElements) {
-            *dest = m_buffer[m_readIdx];
+            *dest = std::move(m_buffer[m_readIdx]);
+            releaseSlots(m_readIdx, 1);
             m_readIdx = (m_readIdx + 1) % t_size;
             --m_nbElements;
         } else {
@@ -100,27 +185,18 @@ class Fifo {
      * @param[in] overwrite Overwrite previous elements if not enough space in the FIFO
      * @return Number of elements copied in the FIFO
      */
-    size_t push(std::span<const T> src, bool overwrite = false) {
-        size_t nbElementsCopied = 0U;
-
-        if ((!overwrite) && (src.size() > (t_size - m_nbElements))) {
-            return 0;
-        }
-
-        for (const T &element : src) {
-            m_buffer[m_writeIdx] = element;
-            m_writeIdx = (m_writeIdx + 1) % t_size;
-
-            if (m_nbElements < t_size) {
-                m_nbElements++;
-                nbElementsCopied++;
-            } else {
-                // in case of data overwrite
-                m_readIdx = m_writeIdx;
-            }
-        }
+    size_t push(std::span<const T> src, bool overwrite = false) { return pushSegments(src, overwrite); }
 
-        return nbElementsCopied;
+    /**
+     * @brief Move data to the FIFO, for move-only types. The source elements are left moved from.
+     * If overwrite is not selected and there is not enough space, leave the FIFO and the source
+     * as is.
+     * @param[in,out] src Source buffer to move the data from
+     * @param[in] overwrite Overwrite previous elements if not enough space in the FIFO
+     * @return Number of elements moved in the FIFO
+     */
+    size_t push_move(std::span<T> src, bool overwrite = false) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        return pushSegments(src, overwrite);
     }
 
     /**
@@ -132,7 +208,44 @@ class Fifo {
      */
     template <size_t t_arrSz>
     size_t push(const std::array<const T, t_arrSz> &src, bool overwrite = false) {
-        return push(std::span<const T>{src}, overwrite);
+        return pushFixed<t_arrSz>(src.data(), overwrite);
+    }
+
+    /**
+     * @brief Write a fixed-size block to the FIFO. The size being known at compile time, the copy
+     * is unrolled or vectorized when the block does not wrap around the end of the container.
+     * If overwrite is not selected and there is not enough space, leave the FIFO as is.
+     * @param[out] src Source block to copy the data from
+     * @param[in] overwrite Overwrite previous elements if not enough space in the FIFO
+     * @return Number of elements copied in the FIFO
+     */
+    template <size_t t_arrSz>
+    size_t push(const std::array<T, t_arrSz> &src, bool overwrite = false) {
+        return pushFixed<t_arrSz>(src.data(), overwrite);
+    }
+
+    /**
+     * @brief Read a fixed-size block from the FIFO and delete the read data. Nothing is read if
+     * the FIFO holds less than a whole block. The copy is unrolled or vectorized when the block
+     * does not wrap around the end of the container.
+     * @param[out] dest Destination block where the data are written to
+     * @return Number of elements read: t_arrSz or 0
+     */
+    template <size_t t_arrSz>
+    size_t pull(std::array<T, t_arrSz> &dest) noexcept(s_nothrowMove) {
+        if (m_nbElements < t_arrSz) {
+            return 0;
+        }
+
+        if ((m_readIdx + t_arrSz) <= t_size) {
+            std::move(m_buffer.begin() + m_readIdx, m_buffer.begin() + m_readIdx + t_arrSz, dest.begin());
+        } else {
+            const auto firstSegment = t_size - m_readIdx;
+            std::move(m_buffer.begin() + m_readIdx, m_buffer.end(), dest.begin());
+            std::move(m_buffer.begin(), m_buffer.begin() + (t_arrSz - firstSegment), dest.begin() + firstSegment);
+        }
+
+        return drop(t_arrSz);
     }
 
     /**
@@ -160,43 +273,420 @@ class Fifo {
     }
 
     /**
-     * @brief Write a single sample it the FIFO.
+     * @brief Write data gathered from several buffers to the FIFO, in order, as a single push:
+     * either all the elements are written or none.
+     * @param[in] srcs Source buffers to copy the data from
+     * @return Number of elements copied in the FIFO
+     */
+    size_t push(std::span<const std::span<const T>> srcs) {
+        size_t nbElements = 0U;
+        for (const auto &src : srcs) {
+            nbElements += src.size();
+        }
+
+        if (nbElements > (t_size - m_nbElements)) {
+            return 0;
+        }
+
+        auto writeIdx = m_writeIdx;
+        for (const auto &src : srcs) {
+            copyToRing(src, writeIdx);
+            writeIdx = (writeIdx + src.size()) % t_size;
+        }
+
+        m_writeIdx = writeIdx;
+        m_nbElements += nbElements;
+        m_nextSeq += nbElements;
+
+        return nbElements;
+    }
+
+    /**
+     * @brief Write the elements of any input range to the FIFO. Sized contiguous ranges of T go
+     * through the bulk copy push; other sized ranges are pushed only if they fit, like a bulk push;
+     * unsized ranges (e.g. generators) are pushed element by element until the FIFO is full.
+     * @param[in] src Range of elements convertible to T
+     * @param[in] overwrite Overwrite previous elements if not enough space in the FIFO
+     * @return Number of elements copied in the FIFO, overwritten slots excluded
+     */
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+    size_t push_range(R &&src, bool overwrite = false) {
+        if constexpr (std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+                      std::is_same_v<std::ranges::range_value_t<R>, T>) {
+            return push(std::span<const T>{std::ranges::data(src), std::ranges::size(src)}, overwrite);
+        } else {
+            if constexpr (std::ranges::sized_range<R>) {
+                if ((!overwrite) && (std::ranges::size(src) > (t_size - m_nbElements))) {
+                    return 0;
+                }
+            }
+
+            size_t nbElementsCopied = 0U;
+            for (auto &&element : src) {
+                if ((m_nbElements == t_size) && (!overwrite)) {
+                    break;
+                }
+                nbElementsCopied += push(T(std::forward<decltype(element)>(element)), overwrite) ? 1U : 0U;
+            }
+            return nbElementsCopied;
+        }
+    }
+
+    /**
+     * @brief Get a view on the free slots following the last element, to write elements in place.
+     * The elements are only added to the FIFO by commit().
+     * @warning The spans are invalidated by any operation writing to the FIFO
+     * @param[in] size Maximum number of slots to view
+     * @return Pair of spans, the second one is empty if the free slots do not wrap
+     */
+    std::pair<std::span<T>, std::span<T>> write_span(size_t size) {
+        size = std::min(size, t_size - m_nbElements);
+
+        const auto firstSegment = std::min(size, t_size - m_writeIdx);
+
+        return std::pair{std::span<T>{m_buffer.data() + m_writeIdx, firstSegment},
+                         std::span<T>{m_buffer.data(), size - firstSegment}};
+    }
+
+    /**
+     * @brief Add to the FIFO the elements written in place through write_span()
+     * @param[in] size Number of elements written
+     * @return Number of elements added, limited by the free space
+     */
+    size_t commit(size_t size) {
+        size = std::min(size, t_size - m_nbElements);
+
+        m_writeIdx = (m_writeIdx + size) % t_size;
+        m_nbElements += size;
+        m_nextSeq += size;
+
+        return size;
+    }
+
+    /**
+     * @brief Write a single sample it the FIFO. The sample is moved in place, so move-only types
+     * can be pushed one by one.
      * @param[in] sample to write
      * @param[in] overwrite Overwrite previous element if not enough space in the FIFO
      * @return True if the sample was written, otherwise false.
      */
-    bool push(T var, bool overwrite = false) { return (push(&var, 1, overwrite) != 0); }
+    bool push(T var, bool overwrite = false) {
+        const bool isFull = (m_nbElements == t_size);
+
+        if (isFull && (!overwrite)) {
+            return false;
+        }
+
+        m_buffer[m_writeIdx] = std::move(var);
+        m_writeIdx = (m_writeIdx + 1) % t_size;
+
+        if (isFull) {
+            // in case of data overwrite
+            m_readIdx = m_writeIdx;
+        } else {
+            m_nbElements++;
+        }
+
+        m_nextSeq++;
+
+        return !isFull;
+    }
+
+    /**
+     * @brief Write data at the front of the FIFO, before the elements already there: src[0]
+     * becomes the first element to read. If there is not enough space, leave the FIFO as is.
+     * @note The new elements take the sequence numbers before the oldest one. At the very
+     * beginning of the sequence, the elements already there are renumbered; Readers follow the
+     * renumbering and keep their position, the new elements stay before them.
+     * @param[in] src Source buffer to copy the data from
+     * @return Number of elements copied in the FIFO
+     */
+    size_t push_front(std::span<const T> src) {
+        if (src.size() > (t_size - m_nbElements)) {
+            return 0;
+        }
+
+        const auto first = getFirstSequence();
+        if (first < src.size()) {
+            renumber(src.size() - first);
+        }
+
+        m_readIdx = (m_readIdx + t_size - src.size()) % t_size;
+        copyToRing(src, m_readIdx);
+        m_nbElements += src.size();
+
+        return src.size();
+    }
+
+    /**
+     * @brief Write data at the front of the FIFO. If there is not enough space, leave the FIFO
+     * as is.
+     * @param[in] src Initializer list containing elements to push to the FIFO
+     * @return Number of elements copied in the FIFO
+     */
+    size_t push_front(const std::initializer_list<T> &src) {
+        return push_front(std::span<const T>{src.begin(), src.size()});
+    }
+
+    /**
+     * @brief Write a single sample at the front of the FIFO, it becomes the first one to read
+     * @param[in] sample to write
+     * @return True if the sample was written, otherwise false.
+     */
+    bool push_front(T var) {
+        if (m_nbElements == t_size) {
+            return false;
+        }
+
+        if (getFirstSequence() == 0U) {
+            renumber(1U);
+        }
+
+        m_readIdx = (m_readIdx + t_size - 1) % t_size;
+        m_buffer[m_readIdx] = std::move(var);
+        m_nbElements++;
+
+        return true;
+    }
+
+    /**
+     * @brief Pull the last element pushed to the FIFO
+     * @param[out] dest Where the element is moved to
+     * @return True if reading is done, otherwise false
+     */
+    bool pop_back(T *const dest) noexcept(s_nothrowMove) {
+        assert(dest != nullptr);
+
+        if (m_nbElements == 0) {
+            return false;
+        }
+
+        m_writeIdx = (m_writeIdx + t_size - 1) % t_size;
+        *dest = std::move(m_buffer[m_writeIdx]);
+        releaseSlots(m_writeIdx, 1);
+        --m_nbElements;
+        --m_nextSeq;
+        noteRewind(1U);
+
+        return true;
+    }
+
+    /**
+     * @brief Drop the last samples pushed to the FIFO, as if they had never been pushed. Their
+     * sequence numbers are given again to the next pushed samples, Readers detect it, see
+     * Reader::getRetracted().
+     * @return Number of samples dropped
+     */
+    size_t drop_back(size_t size) noexcept(s_nothrowMove) {
+        auto droppedSamples = std::min(m_nbElements, size);
+        m_nbElements -= droppedSamples;
+        m_writeIdx = (m_writeIdx + t_size - droppedSamples) % t_size;
+        releaseSlots(m_writeIdx, droppedSamples);
+        m_nextSeq -= droppedSamples;
+        noteRewind(droppedSamples);
+        return droppedSamples;
+    }
+
+    /**
+     * @brief Rotate the FIFO contents in place so that they start at the beginning of the
+     * container, without any extra buffer.
+     * @warning The returned span is invalidated by any other operation on the FIFO
+     * @return All the elements of the FIFO, as a single contiguous span
+     */
+    std::span<T> linearize() {
+        if (m_readIdx != 0U) {
+            if ((m_readIdx + m_nbElements) <= t_size) {
+                // contents do not wrap: a single move to the front is enough
+                std::move(m_buffer.begin() + m_readIdx, m_buffer.begin() + m_readIdx + m_nbElements,
+                          m_buffer.begin());
+            } else if (m_nbElements == t_size) {
+                std::rotate(m_buffer.begin(), m_buffer.begin() + m_readIdx, m_buffer.end());
+            } else {
+                // move the head segment down against the tail one, then swap them: only the
+                // slots holding elements are touched, free slots may be uninitialized
+                const auto headSize = t_size - m_readIdx;
+                std::move(m_buffer.begin() + m_readIdx, m_buffer.end(), m_buffer.begin() + m_writeIdx);
+                std::rotate(m_buffer.begin(), m_buffer.begin() + m_writeIdx,
+                            m_buffer.begin() + m_writeIdx + headSize);
+            }
+
+            m_readIdx = 0U;
+            m_writeIdx = m_nbElements % t_size;
+        }
+
+        return std::span<T>{m_buffer.data(), m_nbElements};
+    }
 
     /**
      * @brief Drop a number of samples of the FIFO. These samples cannot be retrieved.
      * @return Number of samples dropped
      */
-    size_t drop(size_t size) {
+    size_t drop(size_t size) noexcept(s_nothrowMove) {
         auto droppedSamples = std::min(m_nbElements, size);
+        releaseSlots(m_readIdx, droppedSamples);
         m_nbElements -= droppedSamples;
         m_readIdx = (m_readIdx + droppedSamples) % t_size;
         return droppedSamples;
     }
 
     /**
-     * @brief Read data from the FIFO and delete the read data
+     * @brief Remove all the elements matching a predicate. The FIFO is compacted in place in a
+     * single pass over its two contiguous segments, the remaining elements keep their order.
+     * @note The remaining elements are renumbered: they keep the last sequence numbers.
+     * @param[in] pred Predicate called once per element, returns true if the element is removed
+     * @return Number of elements removed
+     */
+    template <typename Predicate>
+    size_t remove_if(Predicate pred) {
+        auto keepIdx = m_readIdx;
+        size_t nbKept = 0U;
+
+        auto compact = [&](size_t begin, size_t end) {
+            for (size_t idx = begin; idx < end; idx++) {
+                if (!pred(std::as_const(m_buffer[idx]))) {
+                    if (keepIdx != idx) {
+                        m_buffer[keepIdx] = std::move(m_buffer[idx]);
+                    }
+                    keepIdx = (keepIdx + 1 == t_size) ? 0U : (keepIdx + 1);
+                    nbKept++;
+                }
+            }
+        };
+
+        const auto firstSegment = std::min(m_nbElements, t_size - m_readIdx);
+        compact(m_readIdx, m_readIdx + firstSegment);
+        compact(0U, m_nbElements - firstSegment);
+
+        const auto nbRemoved = m_nbElements - nbKept;
+
+        releaseSlots(keepIdx, nbRemoved);
+
+        m_writeIdx = keepIdx;
+        m_nbElements = nbKept;
+
+        return nbRemoved;
+    }
+
+    /**
+     * @brief Consume the first elements of the FIFO in place, without copying them out: the
+     * function is called on each element, or once per contiguous segment if it takes a
+     * std::span<T>, then the elements are deleted from the FIFO.
+     * @param[in] size Maximum number of elements to consume
+     * @param[in] fn Function taking a T& or a std::span<T>
+     * @return Number of elements consumed
+     */
+    template <typename Function>
+    size_t consume(size_t size, Function fn) {
+        const auto [first, second] = peek_span(0U, size);
+
+        for (const auto &segment : {first, second}) {
+            if constexpr (std::is_invocable_v<Function &, std::span<T>>) {
+                if (!segment.empty()) {
+                    fn(segment);
+                }
+            } else {
+                for (T &element : segment) {
+                    fn(element);
+                }
+            }
+        }
+
+        return drop(first.size() + second.size());
+    }
+
+    /**
+     * @brief Consume all the elements of the FIFO in place, see consume()
+     * @param[in] fn Function taking a T& or a std::span<T>
+     * @return Number of elements consumed
+     */
+    template <typename Function>
+    size_t consume_all(Function fn) {
+        return consume(m_nbElements, std::move(fn));
+    }
+
+    /**
+     * @brief Read data from the FIFO and delete the read data. Elements are moved out, segment by
+     * segment, so move-only types can be pulled in bulk.
      * @param[out] dest Destination buffer where the data are written to
      * @param[in] availSpace Available space in the destination buffer, in elements
      * @return Number of elements read
      */
-    size_t pull(T *destination, size_t availSpace) {
-        const auto nbElementsToCopy = availSpace;
+    size_t pull(T *destination, size_t availSpace) noexcept(s_nothrowMove) {
         assert(destination != nullptr);
 
-        while (availSpace > 0 && m_nbElements > 0) {
-            *destination = m_buffer[m_readIdx];
-            m_readIdx = (m_readIdx + 1) % t_size;
-            destination++;
-            --availSpace;
-            --m_nbElements;
+        const auto [first, second] = peek_span(0U, availSpace);
+        std::move(second.begin(), second.end(), std::move(first.begin(), first.end(), destination));
+
+        return drop(first.size() + second.size());
+    }
+
+    /**
+     * @brief Read data from the FIFO into several buffers, filled in order, and delete the read
+     * data. Elements are moved out and the read index is updated once.
+     * @param[out] dests Destination buffers where the data are written to
+     * @return Number of elements read
+     */
+    size_t pull(std::span<const std::span<T>> dests) noexcept(s_nothrowMove) {
+        size_t nbRead = 0U;
+
+        for (const auto &dest : dests) {
+            const auto [first, second] = peek_span(nbRead, dest.size());
+            std::move(second.begin(), second.end(), std::move(first.begin(), first.end(), dest.begin()));
+            nbRead += first.size() + second.size();
         }
 
-        return (nbElementsToCopy - availSpace);
+        return drop(nbRead);
+    }
+
+    /**
+     * @brief Write big-endian integers to the FIFO, converted to native byte order while they are
+     * copied. If overwrite is not selected and there is not enough space, leave the FIFO as is.
+     * @param[in] src Source buffer of big-endian elements
+     * @param[in] overwrite Overwrite previous elements if not enough space in the FIFO
+     * @return Number of elements copied in the FIFO
+     */
+    size_t push_be(std::span<const T> src, bool overwrite = false)
+        requires std::is_integral_v<T>
+    {
+        return pushEndian<std::endian::big>(src, overwrite);
+    }
+
+    /**
+     * @brief Write little-endian integers to the FIFO, see push_be()
+     * @param[in] src Source buffer of little-endian elements
+     * @param[in] overwrite Overwrite previous elements if not enough space in the FIFO
+     * @return Number of elements copied in the FIFO
+     */
+    size_t push_le(std::span<const T> src, bool overwrite = false)
+        requires std::is_integral_v<T>
+    {
+        return pushEndian<std::endian::little>(src, overwrite);
+    }
+
+    /**
+     * @brief Read data from the FIFO as big-endian integers, converted from native byte order
+     * while they are copied, and delete the read data.
+     * @param[out] dest Destination buffer where the big-endian elements are written to
+     * @param[in] availSpace Available space in the destination buffer, in elements
+     * @return Number of elements read
+     */
+    size_t pull_be(T *destination, size_t availSpace)
+        requires std::is_integral_v<T>
+    {
+        return pullEndian<std::endian::big>(destination, availSpace);
+    }
+
+    /**
+     * @brief Read data from the FIFO as little-endian integers, see pull_be()
+     * @param[out] dest Destination buffer where the little-endian elements are written to
+     * @param[in] availSpace Available space in the destination buffer, in elements
+     * @return Number of elements read
+     */
+    size_t pull_le(T *destination, size_t availSpace)
+        requires std::is_integral_v<T>
+    {
+        return pullEndian<std::endian::little>(destination, availSpace);
     }
 
     /**
@@ -205,24 +695,34 @@ class Fifo {
      * @warning This does not delete the data from the FIFO
      * @param[out] dest Destination buffer where the data are written to
      * @param[in] availSpace Available space in the destination buffer, in elements
+     * @param[in] offset Number of elements to skip from the first element of the FIFO
      * @return Number of elements read
      */
-    size_t read(T *destination, size_t availSpace) const {
-        const auto nbElementsToCopy = availSpace;
+    size_t read(T *destination, size_t availSpace, size_t offset = 0U) const {
         assert(destination != nullptr);
 
-        auto readIdx = m_readIdx;
-        auto remainInFifo = m_nbElements;
+        const auto [first, second] = peek_span(offset, availSpace);
+        std::copy(first.begin(), first.end(), destination);
+        std::copy(second.begin(), second.end(), destination + first.size());
 
-        while (availSpace > 0 && remainInFifo > 0) {
-            *destination = m_buffer[readIdx];
-            readIdx = (readIdx + 1) % t_size;
-            destination++;
-            --availSpace;
-            --remainInFifo;
-        }
+        return first.size() + second.size();
+    }
 
-        return (nbElementsToCopy - availSpace);
+    /**
+     * @brief Get a view on elements of the FIFO without copying nor deleting them. As the
+     * elements may wrap around the end of the container, they are split in two contiguous spans.
+     * @warning The spans are invalidated by any operation writing to the FIFO
+     * @param[in] offset Number of elements to skip from the first element of the FIFO
+     * @param[in] size Maximum number of elements to view
+     * @return Pair of spans, the second one is empty if the elements do not wrap
+     */
+    std::pair<std::span<const T>, std::span<const T>> peek_span(size_t offset, size_t size) const {
+        return segments(*this, offset, size);
+    }
+
+    /// @copydoc peek_span
+    std::pair<std::span<T>, std::span<T>> peek_span(size_t offset, size_t size) {
+        return segments(*this, offset, size);
     }
 
     /**
@@ -234,6 +734,281 @@ class Fifo {
         return (m_buffer[readIndex]);
     }
 
+    /**
+     * @brief Output iterator appending to the FIFO, so that the FIFO can be the destination of
+     * std::ranges::copy, std::format_to, ...
+     * @warning Without overwrite, elements assigned while the FIFO is full are discarded
+     */
+    class BackInserter {
+      public:
+        using iterator_category = std::output_iterator_tag;
+        using value_type = void;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = void;
+
+        BackInserter() = default;
+        BackInserter(Fifo<T, t_size> &fifo, bool overwrite) : m_fifo(&fifo), m_overwrite(overwrite) {}
+
+        BackInserter &operator=(const T &value) {
+            m_fifo->push(value, m_overwrite);
+            return *this;
+        }
+
+        BackInserter &operator=(T &&value) {
+            m_fifo->push(std::move(value), m_overwrite);
+            return *this;
+        }
+
+        BackInserter &operator*() { return *this; }
+        BackInserter &operator++() { return *this; }
+        BackInserter operator++(int) { return *this; }
+
+      private:
+        Fifo<T, t_size> *m_fifo{nullptr};
+        bool m_overwrite{false};
+    };
+
+    /**
+     * @brief Get an output iterator appending to the FIFO
+     * @param[in] overwrite Overwrite previous elements if not enough space in the FIFO
+     * @return Output iterator
+     */
+    BackInserter back_inserter(bool overwrite = false) { return BackInserter(*this, overwrite); }
+
+    /**
+     * @brief Header written in front of the elements of a snapshot
+     */
+    struct SnapshotHeader {
+        uint32_t magic;
+        uint32_t elementSize;
+        uint64_t headSeq;
+        uint64_t dataSeq;
+        uint64_t nbElements;
+    };
+
+    /**
+     * @brief Size of the largest snapshot of this FIFO, in bytes
+     */
+    static constexpr size_t s_maxSnapshotSize{sizeof(SnapshotHeader) + (t_size * sizeof(T))};
+
+    /**
+     * @brief Write an image of the FIFO: a small header followed by the elements, copied in at
+     * most two blocks. Only for trivially copyable types.
+     * @param[out] dest Where the image is written, up to s_maxSnapshotSize bytes
+     * @return Number of bytes written, 0 if dest is too small
+     */
+    size_t snapshot(std::span<std::byte> dest) const
+        requires std::is_trivially_copyable_v<T>
+    {
+        return snapshot(dest, getFirstSequence());
+    }
+
+    /**
+     * @brief Write a delta image of the FIFO since a previous snapshot: only the elements pushed
+     * since then are written, along with the sequence number of the current first element.
+     * @warning Only valid if the elements are pushed at the back and pulled from the front,
+     * e.g. not after push_front() or remove_if()
+     * @param[out] dest Where the image is written
+     * @param[in] sinceSeq getNextSequence() at the time of the previous snapshot
+     * @return Number of bytes written, 0 if dest is too small
+     */
+    size_t snapshot(std::span<std::byte> dest, uint64_t sinceSeq) const
+        requires std::is_trivially_copyable_v<T>
+    {
+        const auto dataSeq = std::clamp(sinceSeq, getFirstSequence(), getNextSequence());
+        const auto [first, second] =
+            peek_span(static_cast<size_t>(dataSeq - getFirstSequence()), m_nbElements);
+        const auto nbElements = first.size() + second.size();
+        const auto size = sizeof(SnapshotHeader) + (nbElements * sizeof(T));
+
+        if (dest.size() < size) {
+            return 0;
+        }
+
+        const SnapshotHeader header{s_snapshotMagic, sizeof(T), getFirstSequence(), dataSeq, nbElements};
+        std::memcpy(dest.data(), &header, sizeof(header));
+        std::memcpy(dest.data() + sizeof(header), first.data(), first.size_bytes());
+        std::memcpy(dest.data() + sizeof(header) + first.size_bytes(), second.data(), second.size_bytes());
+
+        return size;
+    }
+
+    /**
+     * @brief Restore an image written by snapshot(). A full image replaces the contents of the
+     * FIFO; a delta image is applied on top of the state of the previous snapshot.
+     * @param[in] src Image to restore
+     * @return True if the image was restored, false if it is invalid or does not apply to the
+     * current state; the FIFO is left as is in that case
+     */
+    bool restore(std::span<const std::byte> src)
+        requires std::is_trivially_copyable_v<T>
+    {
+        SnapshotHeader header;
+
+        if (src.size() < sizeof(header)) {
+            return false;
+        }
+        std::memcpy(&header, src.data(), sizeof(header));
+
+        if ((header.magic != s_snapshotMagic) || (header.elementSize != sizeof(T)) ||
+            (header.dataSeq < header.headSeq) || (header.nbElements > t_size) ||
+            (src.size() < (sizeof(header) + (header.nbElements * sizeof(T))))) {
+            return false;
+        }
+
+        // a full image holds all the elements, otherwise it shall follow the current contents
+        // and still hold the elements from the image head, which were not part of it
+        const bool isFull = (header.dataSeq == header.headSeq);
+        if ((!isFull) && ((header.dataSeq != getNextSequence()) || (getFirstSequence() > header.headSeq))) {
+            return false;
+        }
+
+        const auto nbKept = isFull ? 0U : static_cast<size_t>(getNextSequence() - header.headSeq);
+        if ((nbKept + header.nbElements) > t_size) {
+            return false;
+        }
+
+        drop(m_nbElements - nbKept);
+        if (m_nbElements == 0U) {
+            m_readIdx = 0U;
+            m_writeIdx = 0U;
+            m_nextSeq = header.dataSeq;
+        }
+
+        const auto [first, second] = write_span(static_cast<size_t>(header.nbElements));
+        std::memcpy(first.data(), src.data() + sizeof(header), first.size_bytes());
+        std::memcpy(second.data(), src.data() + sizeof(header) + first.size_bytes(), second.size_bytes());
+        commit(first.size() + second.size());
+
+        return true;
+    }
+
+    /**
+     * @brief Reader reading forward from a sequence number, without consuming the data. With
+     * overwrite, this turns the FIFO into a small log that can be replayed.
+     * @warning The reader keeps a reference on the FIFO, it shall not outlive it
+     */
+    class Reader {
+      public:
+        Reader() = delete;
+
+        /**
+         * @brief Construct a reader positioned at a sequence number
+         * @param[in] fifo FIFO to read
+         * @param[in] seq Sequence number of the first element to read
+         */
+        Reader(const Fifo<T, t_size> &fifo, uint64_t seq)
+            : m_fifo(fifo), m_seq(seq), m_syncSeq(fifo.getNextSequence()), m_syncRewinds(fifo.m_nbRewinds),
+              m_syncRetracted(fifo.m_nbRetracted), m_syncRenumbered(fifo.m_nbRenumbered) {
+            seek(seq);
+        }
+
+        /**
+         * @brief Move to a sequence number. If this element is not in the FIFO anymore, the reader
+         * is moved to the oldest element.
+         * @param[in] seq Sequence number of the next element to read
+         * @return Number of elements missed, between seq and the oldest element
+         */
+        uint64_t seek(uint64_t seq) {
+            resync();
+            const auto first = m_fifo.getFirstSequence();
+            const auto missed = (seq < first) ? (first - seq) : 0U;
+
+            m_seq = seq + missed;
+            m_missed += missed;
+
+            return missed;
+        }
+
+        /**
+         * @brief Read the next elements. Elements overwritten since the last read are skipped and
+         * added to the missed count. If elements already read were withdrawn with pop_back() or
+         * drop_back(), their sequence numbers were given to new elements: the reader goes back to
+         * read them and adds the withdrawn elements to the retracted count.
+         * @param[out] dest Destination buffer where the data are written to
+         * @param[in] availSpace Available space in the destination buffer, in elements
+         * @return Number of elements read
+         */
+        size_t read(T *destination, size_t availSpace) {
+            assert(destination != nullptr);
+            resync();
+            rewind();
+            seek(m_seq);
+
+            const auto offset = static_cast<size_t>(m_seq - m_fifo.getFirstSequence());
+            const auto nbElementsToCopy = m_fifo.read(destination, availSpace, offset);
+
+            m_seq += nbElementsToCopy;
+            m_syncSeq = m_fifo.getNextSequence();
+            return nbElementsToCopy;
+        }
+
+        /// @brief Sequence number of the next element to read
+        uint64_t getSequence() const { return m_seq; }
+
+        /// @brief Total number of elements missed because they were overwritten or consumed
+        uint64_t getMissed() const { return m_missed; }
+
+        /**
+         * @brief Total number of elements read then withdrawn from the back of the FIFO. If the
+         * FIFO was rewound several times between two reads, some elements may be counted and read
+         * again although they were not withdrawn: an element is never silently skipped.
+         */
+        uint64_t getRetracted() const { return m_retracted; }
+
+      private:
+        /**
+         * @brief Follow the elements renumbered by push_front() since the last read: the reader
+         * keeps its position in the elements, push_front() elements stay before it
+         */
+        void resync() {
+            const auto shift = m_fifo.m_nbRenumbered - m_syncRenumbered;
+
+            m_seq += shift;
+            m_syncSeq += shift;
+            m_syncRenumbered = m_fifo.m_nbRenumbered;
+        }
+
+        /**
+         * @brief Go back to the lowest sequence number the FIFO may have been rewound to since the
+         * last read
+         */
+        void rewind() {
+            const auto nbRewinds = m_fifo.m_nbRewinds - m_syncRewinds;
+            if (nbRewinds == 0U) {
+                return;
+            }
+
+            // a single rewind went exactly down to m_rewindSeq, several ones went at worst down
+            // by the number of withdrawn elements
+            const auto nbRetracted = m_fifo.m_nbRetracted - m_syncRetracted;
+            const auto floor = (nbRewinds == 1U)             ? m_fifo.m_rewindSeq
+                               : (m_syncSeq > nbRetracted) ? (m_syncSeq - nbRetracted)
+                                                           : 0U;
+
+            if (m_seq > floor) {
+                m_retracted += m_seq - floor;
+                m_seq = floor;
+            }
+            m_syncRewinds = m_fifo.m_nbRewinds;
+            m_syncRetracted = m_fifo.m_nbRetracted;
+        }
+
+        const Fifo<T, t_size> &m_fifo;
+        uint64_t m_seq;
+        uint64_t m_missed{0U};
+        uint64_t m_retracted{0U};
+
+        /// @brief FIFO next sequence number, rewind and withdrawal counts at the last read
+        uint64_t m_syncSeq;
+        uint64_t m_syncRewinds;
+        uint64_t m_syncRetracted;
+
+        /// @brief FIFO renumbering count at the last read or seek
+        uint64_t m_syncRenumbered;
+    };
+
     /**
      * @brief Iterator object to simplify operations on FIFO
      */
@@ -291,9 +1066,240 @@ class Fifo {
 
   private:
     /**
-     * @brief Container where the FIFO elements are stored
+     * @brief Split the elements [offset, offset + size) of the FIFO in two contiguous spans,
+     * clamped to the elements actually in the FIFO
      */
-    std::array<T, t_size> m_buffer{};
+    template <typename Self>
+    static auto segments(Self &self, size_t offset, size_t size) {
+        using Element = std::conditional_t<std::is_const_v<Self>, const T, T>;
+
+        offset = std::min(offset, self.m_nbElements);
+        size = std::min(size, self.m_nbElements - offset);
+
+        const auto start = (self.m_readIdx + offset) % t_size;
+        const auto firstSegment = std::min(size, t_size - start);
+
+        return std::pair{std::span<Element>{self.m_buffer.data() + start, firstSegment},
+                         std::span<Element>{self.m_buffer.data(), size - firstSegment}};
+    }
+
+    /**
+     * @brief First bytes of a snapshot image
+     */
+    static constexpr uint32_t s_snapshotMagic{0x4F464946U};
+
+    /**
+     * @brief True if moving elements out and releasing slots cannot throw
+     */
+    static constexpr bool s_nothrowMove{std::is_nothrow_move_assignable_v<T> &&
+                                        (std::is_trivially_destructible_v<T> ||
+                                         std::is_nothrow_default_constructible_v<T>)};
+
+    /**
+     * @brief Shift the sequence numbers of all the elements, to make room before the first one.
+     * Recorded for the Readers, see Reader::read().
+     * @param[in] shift Number of sequence numbers to add
+     */
+    void renumber(uint64_t shift) {
+        m_nextSeq += shift;
+        m_rewindSeq += shift;
+        m_nbRenumbered += shift;
+    }
+
+    /**
+     * @brief Record a withdrawal from the back, for the Readers, see Reader::getRetracted()
+     * @param[in] size Number of elements withdrawn
+     */
+    void noteRewind(size_t size) {
+        if (size != 0U) {
+            m_nbRetracted += size;
+            m_nbRewinds++;
+            m_rewindSeq = m_nextSeq;
+        }
+    }
+
+    /**
+     * @brief Reset slots that do not hold an element anymore, so that the resources owned by
+     * their previous value are released now rather than when the slot is written again.
+     * Nothing to do for trivially destructible types.
+     * @param[in] idx Index of the first slot
+     * @param[in] size Number of slots
+     */
+    void releaseSlots(size_t idx, size_t size) noexcept(s_nothrowMove) {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < size; i++) {
+                m_buffer[idx] = T{};
+                idx = (idx + 1 == t_size) ? 0U : (idx + 1);
+            }
+        }
+    }
+
+    /**
+     * @brief Replace the contents by the ones of another FIFO, of any capacity. Elements are moved
+     * if the other FIFO is an rvalue, which is then left empty.
+     */
+    template <typename Other>
+    void assignFrom(Other &&other) {
+        releaseSlots(m_readIdx, m_nbElements);
+
+        const auto nbElements = std::min(other.getCount(), t_size);
+        const auto [first, second] = other.peek_span(other.getCount() - nbElements, nbElements);
+
+        if constexpr (std::is_const_v<std::remove_reference_t<Other>> || std::is_lvalue_reference_v<Other>) {
+            std::copy(second.begin(), second.end(), std::copy(first.begin(), first.end(), m_buffer.begin()));
+        } else {
+            std::move(second.begin(), second.end(), std::move(first.begin(), first.end(), m_buffer.begin()));
+        }
+
+        m_readIdx = 0U;
+        m_writeIdx = nbElements % t_size;
+        m_nbElements = nbElements;
+        m_nextSeq = other.getNextSequence();
+
+        if constexpr (!std::is_lvalue_reference_v<Other>) {
+            other.reset();
+        }
+    }
+
+    /**
+     * @brief Write a fixed-size block to the FIFO, see push(const std::array<T, t_arrSz> &)
+     */
+    template <size_t t_arrSz>
+    size_t pushFixed(const T *src, bool overwrite) {
+        if constexpr (t_arrSz > t_size) {
+            return pushSegments(std::span<const T>{src, t_arrSz}, overwrite);
+        } else {
+            if (t_arrSz > (t_size - m_nbElements)) {
+                return overwrite ? pushSegments(std::span<const T>{src, t_arrSz}, overwrite) : 0U;
+            }
+
+            if ((m_writeIdx + t_arrSz) <= t_size) {
+                std::copy_n(src, t_arrSz, m_buffer.begin() + m_writeIdx);
+            } else {
+                copyToRing(std::span<const T>{src, t_arrSz}, m_writeIdx);
+            }
+
+            m_writeIdx = (m_writeIdx + t_arrSz) % t_size;
+            m_nbElements += t_arrSz;
+            m_nextSeq += t_arrSz;
+
+            return t_arrSz;
+        }
+    }
+
+    /**
+     * @brief Reverse the bytes of an integer, with portable shifts and masks that compilers
+     * recognize as a byte swap instruction, or a vector shuffle in loops
+     */
+    static constexpr T byteswap(T var) noexcept {
+        using Unsigned = std::make_unsigned_t<T>;
+        auto bits = static_cast<uint64_t>(static_cast<Unsigned>(var));
+
+        if constexpr (sizeof(T) >= 2U) {
+            bits = ((bits & 0x00FF00FF00FF00FFU) << 8U) | ((bits >> 8U) & 0x00FF00FF00FF00FFU);
+        }
+        if constexpr (sizeof(T) >= 4U) {
+            bits = ((bits & 0x0000FFFF0000FFFFU) << 16U) | ((bits >> 16U) & 0x0000FFFF0000FFFFU);
+        }
+        if constexpr (sizeof(T) >= 8U) {
+            static_assert(sizeof(T) == 8U, "Unsupported integer size");
+            bits = (bits << 32U) | (bits >> 32U);
+        }
+
+        return static_cast<T>(static_cast<Unsigned>(bits));
+    }
+
+    /**
+     * @brief Write integers stored with a given byte order, see push_be()
+     */
+    template <std::endian t_order>
+    size_t pushEndian(std::span<const T> src, bool overwrite) {
+        if constexpr (t_order == std::endian::native) {
+            return pushSegments(src, overwrite);
+        } else {
+            return pushSegments(src, overwrite, [](T var) { return byteswap(var); });
+        }
+    }
+
+    /**
+     * @brief Read integers to be stored with a given byte order, see pull_be()
+     */
+    template <std::endian t_order>
+    size_t pullEndian(T *destination, size_t availSpace) {
+        assert(destination != nullptr);
+
+        const auto [first, second] = peek_span(0U, availSpace);
+
+        if constexpr (t_order == std::endian::native) {
+            std::copy(second.begin(), second.end(), std::copy(first.begin(), first.end(), destination));
+        } else {
+            const auto swap = [](T var) { return byteswap(var); };
+            std::transform(second.begin(), second.end(), std::transform(first.begin(), first.end(), destination, swap),
+                           swap);
+        }
+
+        return drop(first.size() + second.size());
+    }
+
+    /**
+     * @brief Write data to the FIFO, see push(). Elements are moved if the source is not const.
+     * A projection, such as a byte swap, can be applied to the elements while they are copied.
+     */
+    template <typename U, typename Proj = std::identity>
+    size_t pushSegments(std::span<U> src, bool overwrite, Proj proj = {}) {
+        const auto freeSpace = t_size - m_nbElements;
+
+        if ((!overwrite) && (src.size() > freeSpace)) {
+            return 0;
+        }
+
+        // in case of data overwrite, only the last t_size elements remain
+        const auto nbWritten = std::min(src.size(), t_size);
+        copyToRing(src.last(nbWritten), (m_writeIdx + src.size() - nbWritten) % t_size, proj);
+        m_writeIdx = (m_writeIdx + src.size()) % t_size;
+
+        const auto nbElementsCopied = std::min(src.size(), freeSpace);
+        m_nbElements += nbElementsCopied;
+
+        if (nbElementsCopied < src.size()) {
+            m_readIdx = m_writeIdx;
+        }
+
+        m_nextSeq += src.size();
+
+        return nbElementsCopied;
+    }
+
+    /**
+     * @brief Copy a contiguous source to the ring, starting at a given index, in at most two bulk
+     * copies. Elements are moved if the source is not const.
+     * @param[in] src Elements to copy, no more than t_size
+     * @param[in] idx Index of the first slot to write
+     * @param[in] proj Projection applied to the elements of a const source
+     */
+    template <typename U, typename Proj = std::identity>
+    void copyToRing(std::span<U> src, size_t idx, Proj proj = {}) {
+        const auto firstSegment = std::min(src.size(), t_size - idx);
+
+        if constexpr (!std::is_same_v<Proj, std::identity>) {
+            static_assert(std::is_const_v<U>, "Projections only apply to copies");
+            std::transform(src.begin(), src.begin() + firstSegment, m_buffer.begin() + idx, proj);
+            std::transform(src.begin() + firstSegment, src.end(), m_buffer.begin(), proj);
+        } else if constexpr (std::is_const_v<U>) {
+            std::copy_n(src.begin(), firstSegment, m_buffer.begin() + idx);
+            std::copy(src.begin() + firstSegment, src.end(), m_buffer.begin());
+        } else {
+            std::move(src.begin(), src.begin() + firstSegment, m_buffer.begin() + idx);
+            std::move(src.begin() + firstSegment, src.end(), m_buffer.begin());
+        }
+    }
+
+    /**
+     * @brief Container where the FIFO elements are stored. Only value-initialized by the default
+     * constructor: after a copy or a move construction, free slots of trivial types are
+     * uninitialized and shall only be written.
+     */
+    std::array<T, t_size> m_buffer;
 
     /**
      * @brief Current read index, where the next data to read is
@@ -309,4 +1315,26 @@ class Fifo {
      * @brief Current nb of elements in the FIFO
      */
     size_t m_nbElements{0U};
+
+    /**
+     * @brief Sequence number of the next written element, also the total nb of written elements
+     */
+    uint64_t m_nextSeq{0U};
+
+    /**
+     * @brief Total nb of elements withdrawn from the back, whose sequence numbers were reused
+     */
+    uint64_t m_nbRetracted{0U};
+
+    /**
+     * @brief Total nb of withdrawals from the back, and next sequence number after the last one
+     */
+    uint64_t m_nbRewinds{0U};
+    uint64_t m_rewindSeq{0U};
+
+    /**
+     * @brief Total shift of the sequence numbers by push_front() at the very beginning of the
+     * sequence
+     */
+    uint64_t m_nbRenumbered{0U};
 };
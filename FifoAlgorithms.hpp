@@ -0,0 +1,217 @@
+/**
+ * @file FifoAlgorithms.hpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include "FIFO.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <span>
+
+#ifdef FIFO_ENABLE_PARALLEL_ALGORITHMS
+// Parallel algorithms may need an extra library, e.g. TBB for libstdc++
+#include <execution>
+#endif
+
+/**
+ * @brief Algorithms over the contents of a Fifo. The user operation runs once per contiguous
+ * segment of the ring (at most two), so the inner loops have no wrap check and can be vectorized.
+ */
+namespace fifo_algorithms {
+
+/**
+ * @brief Call a function on each contiguous segment of the FIFO, in FIFO order
+ * @param[in] fifo FIFO to go through
+ * @param[in] fn Function taking a std::span<const T>
+ * @return The function
+ */
+template <typename T, size_t t_size, typename Function>
+Function for_each_segment(const Fifo<T, t_size> &fifo, Function fn) {
+    const auto [first, second] = fifo.peek_span(0U, fifo.getCount());
+
+    if (!first.empty()) {
+        fn(first);
+    }
+    if (!second.empty()) {
+        fn(second);
+    }
+
+    return fn;
+}
+
+/**
+ * @brief Call a function on each contiguous segment of the FIFO, in FIFO order
+ * @param[in] fifo FIFO to go through
+ * @param[in] fn Function taking a std::span<T>, it can modify the elements
+ * @return The function
+ */
+template <typename T, size_t t_size, typename Function>
+Function for_each_segment(Fifo<T, t_size> &fifo, Function fn) {
+    const auto [first, second] = fifo.peek_span(0U, fifo.getCount());
+
+    if (!first.empty()) {
+        fn(first);
+    }
+    if (!second.empty()) {
+        fn(second);
+    }
+
+    return fn;
+}
+
+/**
+ * @brief Fold the elements of the FIFO in order, like std::accumulate
+ * @param[in] fifo FIFO to go through
+ * @param[in] init Initial value
+ * @param[in] op Binary operation
+ * @return Result of the fold
+ */
+template <typename T, size_t t_size, typename Init, typename BinaryOp = std::plus<>>
+Init accumulate(const Fifo<T, t_size> &fifo, Init init, BinaryOp op = {}) {
+    for_each_segment(fifo, [&](std::span<const T> segment) {
+        init = std::accumulate(segment.begin(), segment.end(), std::move(init), op);
+    });
+    return init;
+}
+
+/**
+ * @brief Reduce the elements of the FIFO in an unspecified order, like std::reduce. The operation
+ * shall be associative and commutative, which allows vectorization of floating point reductions.
+ * @param[in] fifo FIFO to go through
+ * @param[in] init Initial value
+ * @param[in] op Binary operation
+ * @return Result of the reduction
+ */
+template <typename T, size_t t_size, typename Init, typename BinaryOp = std::plus<>>
+Init reduce(const Fifo<T, t_size> &fifo, Init init, BinaryOp op = {}) {
+    for_each_segment(fifo, [&](std::span<const T> segment) {
+        init = std::reduce(segment.begin(), segment.end(), std::move(init), op);
+    });
+    return init;
+}
+
+/**
+ * @brief Count the elements of the FIFO equal to a value
+ * @param[in] fifo FIFO to go through
+ * @param[in] value Value to compare the elements to
+ * @return Number of elements equal to value
+ */
+template <typename T, size_t t_size>
+size_t count(const Fifo<T, t_size> &fifo, const T &value) {
+    size_t nbElements = 0U;
+    for_each_segment(fifo, [&](std::span<const T> segment) {
+        nbElements += static_cast<size_t>(std::count(segment.begin(), segment.end(), value));
+    });
+    return nbElements;
+}
+
+/**
+ * @brief Count the elements of the FIFO matching a predicate
+ * @param[in] fifo FIFO to go through
+ * @param[in] pred Unary predicate
+ * @return Number of elements for which pred returns true
+ */
+template <typename T, size_t t_size, typename Predicate>
+size_t count_if(const Fifo<T, t_size> &fifo, Predicate pred) {
+    size_t nbElements = 0U;
+    for_each_segment(fifo, [&](std::span<const T> segment) {
+        nbElements += static_cast<size_t>(std::count_if(segment.begin(), segment.end(), pred));
+    });
+    return nbElements;
+}
+
+/**
+ * @brief Write the result of an operation on each element of the FIFO to an output, in order
+ * @param[in] fifo FIFO to go through
+ * @param[out] out Output iterator
+ * @param[in] op Unary operation
+ * @return Output iterator past the last written element
+ */
+template <typename T, size_t t_size, typename OutputIt, typename UnaryOp>
+OutputIt transform(const Fifo<T, t_size> &fifo, OutputIt out, UnaryOp op) {
+    for_each_segment(fifo, [&](std::span<const T> segment) {
+        out = std::transform(segment.begin(), segment.end(), out, op);
+    });
+    return out;
+}
+
+/**
+ * @brief Replace each element of the FIFO by the result of an operation on it
+ * @param[in] fifo FIFO to modify
+ * @param[in] op Unary operation
+ */
+template <typename T, size_t t_size, typename UnaryOp>
+void transform(Fifo<T, t_size> &fifo, UnaryOp op) {
+    for_each_segment(fifo, [&](std::span<T> segment) {
+        std::transform(segment.begin(), segment.end(), segment.begin(), op);
+    });
+}
+
+#ifdef FIFO_ENABLE_PARALLEL_ALGORITHMS
+
+/**
+ * @brief Reduce the elements of the FIFO with an execution policy, see reduce()
+ */
+template <typename ExecutionPolicy, typename T, size_t t_size, typename Init, typename BinaryOp = std::plus<>>
+    requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+Init reduce(ExecutionPolicy &&policy, const Fifo<T, t_size> &fifo, Init init, BinaryOp op = {}) {
+    for_each_segment(fifo, [&](std::span<const T> segment) {
+        init = std::reduce(policy, segment.begin(), segment.end(), std::move(init), op);
+    });
+    return init;
+}
+
+/**
+ * @brief Count the elements of the FIFO matching a predicate with an execution policy, see
+ * count_if()
+ */
+template <typename ExecutionPolicy, typename T, size_t t_size, typename Predicate>
+    requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+size_t count_if(ExecutionPolicy &&policy, const Fifo<T, t_size> &fifo, Predicate pred) {
+    size_t nbElements = 0U;
+    for_each_segment(fifo, [&](std::span<const T> segment) {
+        nbElements += static_cast<size_t>(std::count_if(policy, segment.begin(), segment.end(), pred));
+    });
+    return nbElements;
+}
+
+/**
+ * @brief Replace each element of the FIFO by the result of an operation on it with an execution
+ * policy, see transform()
+ */
+template <typename ExecutionPolicy, typename T, size_t t_size, typename UnaryOp>
+    requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+void transform(ExecutionPolicy &&policy, Fifo<T, t_size> &fifo, UnaryOp op) {
+    for_each_segment(fifo, [&](std::span<T> segment) {
+        std::transform(policy, segment.begin(), segment.end(), segment.begin(), op);
+    });
+}
+
+#endif // FIFO_ENABLE_PARALLEL_ALGORITHMS
+
+} // namespace fifo_algorithms
@@ -0,0 +1,140 @@
+/**
+ * @file FifoStreambuf.hpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include "FIFO.hpp"
+
+#include <streambuf>
+
+/**
+ * @brief Stream buffer over a byte Fifo, to use a FIFO with std::ostream and std::istream.
+ * The put area points to the free slots of the FIFO and the get area to its elements, one
+ * contiguous segment at a time, so characters are written and read in place.
+ * @warning While the stream buffer is in use, the FIFO shall only be accessed through it, or
+ * after a call to pubsync()
+ */
+template <size_t t_size>
+class FifoStreambuf : public std::streambuf {
+  public:
+    /**
+     * @brief Construct a new FifoStreambuf object
+     * @param[in] fifo FIFO the characters are written to and read from
+     */
+    explicit FifoStreambuf(Fifo<char, t_size> &fifo) : m_fifo(fifo) {}
+
+    FifoStreambuf(const FifoStreambuf &) = delete;
+    FifoStreambuf &operator=(const FifoStreambuf &) = delete;
+
+    /**
+     * @brief Written characters are left in the FIFO, read characters are removed
+     */
+    ~FifoStreambuf() override { sync(); }
+
+  protected:
+    /**
+     * @brief Put area exhausted: publish the written characters, free the read ones and move to
+     * the next free segment
+     */
+    int_type overflow(int_type ch) override {
+        consume();
+        publish();
+
+        if (pptr() == epptr()) {
+            auto freeSlots = m_fifo.write_span(t_size).first;
+            setp(freeSlots.data(), freeSlots.data() + freeSlots.size());
+        }
+
+        if (traits_type::eq_int_type(ch, traits_type::eof())) {
+            return traits_type::not_eof(ch);
+        }
+
+        if (pptr() == epptr()) {
+            return traits_type::eof();
+        }
+
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+
+        return ch;
+    }
+
+    /**
+     * @brief Get area exhausted: remove the read characters and move to the next segment
+     */
+    int_type underflow() override {
+        consume();
+        publish();
+
+        auto elements = m_fifo.peek_span(0U, t_size).first;
+        setg(elements.data(), elements.data(), elements.data() + elements.size());
+
+        return elements.empty() ? traits_type::eof() : traits_type::to_int_type(*gptr());
+    }
+
+    /**
+     * @brief Number of characters that can be read without blocking
+     */
+    std::streamsize showmanyc() override {
+        publish();
+        const auto available = m_fifo.getCount() - static_cast<size_t>(gptr() - eback());
+        return (available > 0U) ? static_cast<std::streamsize>(available) : -1;
+    }
+
+    /**
+     * @brief Synchronize the FIFO with the stream: written characters are added to it and read
+     * characters are removed from it
+     */
+    int sync() override {
+        consume();
+        publish();
+        setg(nullptr, nullptr, nullptr);
+        setp(nullptr, nullptr);
+        return 0;
+    }
+
+  private:
+    /**
+     * @brief Add the characters of the put area to the FIFO
+     */
+    void publish() {
+        m_fifo.commit(static_cast<size_t>(pptr() - pbase()));
+        setp(pptr(), epptr());
+    }
+
+    /**
+     * @brief Remove the characters read from the get area from the FIFO
+     */
+    void consume() {
+        m_fifo.drop(static_cast<size_t>(gptr() - eback()));
+        setg(gptr(), gptr(), egptr());
+    }
+
+    /**
+     * @brief FIFO the characters are written to and read from
+     */
+    Fifo<char, t_size> &m_fifo;
+};
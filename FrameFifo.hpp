@@ -0,0 +1,214 @@
+/**
+ * @file FrameFifo.hpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <optional>
+#include <span>
+
+/**
+ * @brief FIFO whose unit of transfer is a frame of t_frameSize elements, such as a video line or
+ * an audio block. Indices count frames, not elements, and the storage holds a whole number of
+ * frames so a frame never straddles the wrap: each one is handed out as a single fixed-size span.
+ * Frames can be filled and consumed in place with write_frame()/commit() and
+ * read_frame()/release(), or copied with push()/pull().
+ * This FIFO does NOT support access from concurrent threads.
+ */
+template <typename T, size_t t_frameSize, size_t t_nbFrames>
+class FrameFifo {
+    static_assert(t_frameSize > 0U, "A frame must hold at least one element");
+    static_assert(t_nbFrames > 0U, "The FIFO must hold at least one frame");
+
+  public:
+    /**
+     * @brief View on a single frame
+     */
+    using Frame = std::span<T, t_frameSize>;
+
+    /**
+     * @brief Read-only view on a single frame
+     */
+    using ConstFrame = std::span<const T, t_frameSize>;
+
+    /**
+     * @brief Get current number of frames in the FIFO
+     * @return Number of frames
+     */
+    size_t getCount() const { return m_nbFrames; }
+
+    /**
+     * @brief Get current number of free frames
+     * @return Number of frames that can be pushed
+     */
+    size_t getFreeSpace() const { return t_nbFrames - m_nbFrames; }
+
+    /**
+     * @brief Empty the FIFO, delete all the data
+     */
+    void reset() {
+        m_readIdx = 0;
+        m_writeIdx = 0;
+        m_nbFrames = 0;
+    }
+
+    /**
+     * @brief Get the next free frame, to be filled in place then published with commit()
+     * @return View on the free frame, nothing if the FIFO is full
+     */
+    std::optional<Frame> write_frame() {
+        if (m_nbFrames == t_nbFrames) {
+            return std::nullopt;
+        }
+
+        return frame(m_writeIdx);
+    }
+
+    /**
+     * @brief Publish the frames filled in place through write_frame()
+     * @param[in] nbFrames Number of frames to publish, clamped to the free space
+     * @return Number of frames published
+     */
+    size_t commit(size_t nbFrames = 1U) {
+        nbFrames = std::min(nbFrames, getFreeSpace());
+
+        m_writeIdx = (m_writeIdx + nbFrames) % t_nbFrames;
+        m_nbFrames += nbFrames;
+
+        return nbFrames;
+    }
+
+    /**
+     * @brief Get the oldest frame, to be consumed in place then freed with release()
+     * @return View on the oldest frame, nothing if the FIFO is empty
+     */
+    std::optional<Frame> read_frame() {
+        if (m_nbFrames == 0U) {
+            return std::nullopt;
+        }
+
+        return frame(m_readIdx);
+    }
+
+    /// @copydoc read_frame
+    std::optional<ConstFrame> read_frame() const {
+        if (m_nbFrames == 0U) {
+            return std::nullopt;
+        }
+
+        return frame(m_readIdx);
+    }
+
+    /**
+     * @brief Free the oldest frames
+     * @param[in] nbFrames Number of frames to free, clamped to the number of frames in the FIFO
+     * @return Number of frames freed
+     */
+    size_t release(size_t nbFrames = 1U) {
+        nbFrames = std::min(nbFrames, m_nbFrames);
+
+        m_readIdx = (m_readIdx + nbFrames) % t_nbFrames;
+        m_nbFrames -= nbFrames;
+
+        return nbFrames;
+    }
+
+    /**
+     * @brief Copy a frame to the FIFO
+     * @param[in] src Frame to copy
+     * @param[in] overwrite If the FIFO is full, drop the oldest frame to make room
+     * @return True if the frame was written, otherwise false
+     */
+    bool push(ConstFrame src, bool overwrite = false) {
+        if (m_nbFrames == t_nbFrames) {
+            if (!overwrite) {
+                return false;
+            }
+            release();
+        }
+
+        std::copy_n(src.begin(), t_frameSize, frame(m_writeIdx).begin());
+        return commit() == 1U;
+    }
+
+    /**
+     * @brief Copy the oldest frame out of the FIFO and free it
+     * @param[out] dest Where the frame is copied
+     * @return True if a frame was read, otherwise false
+     */
+    bool pull(Frame dest) {
+        if (m_nbFrames == 0U) {
+            return false;
+        }
+
+        std::copy_n(frame(m_readIdx).begin(), t_frameSize, dest.begin());
+        return release() == 1U;
+    }
+
+    /**
+     * @brief Access a frame, without removing it from the FIFO
+     * @param[in] index Index of the frame, 0 being the oldest one
+     * @return Read-only view on the frame
+     */
+    ConstFrame operator[](size_t index) const {
+        assert(index < m_nbFrames);
+        return frame((m_readIdx + index) % t_nbFrames);
+    }
+
+  private:
+    /**
+     * @brief View on a frame slot of the storage
+     * @param[in] slot Frame slot index
+     */
+    Frame frame(size_t slot) { return Frame{m_buffer.data() + slot * t_frameSize, t_frameSize}; }
+
+    /// @copydoc frame
+    ConstFrame frame(size_t slot) const {
+        return ConstFrame{m_buffer.data() + slot * t_frameSize, t_frameSize};
+    }
+
+    /**
+     * @brief Container where the frames are stored, back to back
+     */
+    std::array<T, t_frameSize * t_nbFrames> m_buffer{};
+
+    /**
+     * @brief Index of the oldest frame
+     */
+    size_t m_readIdx{0U};
+
+    /**
+     * @brief Index of the next frame to write
+     */
+    size_t m_writeIdx{0U};
+
+    /**
+     * @brief Current number of frames in the FIFO
+     */
+    size_t m_nbFrames{0U};
+};
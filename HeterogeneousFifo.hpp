@@ -0,0 +1,253 @@
+/**
+ * @file HeterogeneousFifo.hpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief FIFO of messages of different types, stored in place in a static byte ring.
+ * Each message takes a small header (type tag and record size) plus its own size, rounded up to
+ * the alignment of the ring. Messages never straddle the end of the ring: when a message does not
+ * fit before the end, the remaining bytes are skipped.
+ * This FIFO does NOT support access from concurrent threads.
+ * @tparam t_size Size of the ring in bytes, multiple of the record alignment
+ * @tparam Types Types of the messages the FIFO can hold
+ */
+template <size_t t_size, typename... Types>
+class HeterogeneousFifo {
+    static_assert(sizeof...(Types) > 0, "At least one message type is required");
+    static_assert(sizeof...(Types) < 0xFFFFU, "Too many message types");
+
+    /**
+     * @brief Record header, written in front of each message
+     */
+    struct Header {
+        uint16_t tag;
+        uint16_t reserved;
+        uint32_t recordSize;
+    };
+
+  public:
+    /**
+     * @brief Alignment of each record, also the size taken by a header
+     */
+    static constexpr size_t s_align{std::max({sizeof(Header), alignof(Types)...})};
+
+    static_assert((t_size % s_align) == 0U, "FIFO size shall be a multiple of the record alignment");
+
+    HeterogeneousFifo() = default;
+    HeterogeneousFifo(const HeterogeneousFifo &) = delete;
+    HeterogeneousFifo &operator=(const HeterogeneousFifo &) = delete;
+
+    ~HeterogeneousFifo() { reset(); }
+
+    /**
+     * @brief Number of bytes a message of type M takes in the ring, header included
+     */
+    template <typename M>
+    static constexpr size_t recordSize() {
+        return s_align + (((sizeof(M) + s_align - 1U) / s_align) * s_align);
+    }
+
+    /**
+     * @brief Get current number of messages in the FIFO
+     * @return Number of messages
+     */
+    size_t getCount() const { return m_nbMessages; }
+
+    /**
+     * @brief Get the number of bytes currently used in the ring, including headers and padding
+     * @return Number of bytes
+     */
+    size_t getUsedBytes() const { return m_usedBytes; }
+
+    /**
+     * @brief Empty the FIFO, destroy all the messages
+     */
+    void reset() {
+        while (pop([](auto &) {})) {
+        }
+        m_readIdx = 0U;
+        m_writeIdx = 0U;
+        m_usedBytes = 0U;
+    }
+
+    /**
+     * @brief Construct a message of type M in place at the end of the FIFO
+     * @param[in] args Arguments forwarded to the constructor of M
+     * @return True if the message was written, false if there is not enough space
+     */
+    template <typename M, typename... Args>
+    bool emplace(Args &&...args) {
+        static_assert((std::is_same_v<M, Types> || ...), "Message type not handled by this FIFO");
+        constexpr auto size = recordSize<M>();
+        static_assert(size <= t_size, "Message does not fit in the FIFO");
+
+        if (m_nbMessages == 0U) {
+            // restart from the beginning to get the largest contiguous space
+            m_readIdx = 0U;
+            m_writeIdx = 0U;
+            m_usedBytes = 0U;
+        }
+
+        const auto tail = t_size - m_writeIdx;
+        const auto freeSpace = t_size - m_usedBytes;
+
+        if (size <= tail) {
+            if (size > freeSpace) {
+                return false;
+            }
+        } else {
+            if ((tail + size) > freeSpace) {
+                return false;
+            }
+            writeHeader(m_writeIdx, s_padTag, tail);
+            m_usedBytes += tail;
+            m_writeIdx = 0U;
+        }
+
+        ::new (static_cast<void *>(&m_buffer[m_writeIdx + s_align])) M(std::forward<Args>(args)...);
+        writeHeader(m_writeIdx, s_tagOf<M>, size);
+
+        m_writeIdx = (m_writeIdx + size) % t_size;
+        m_usedBytes += size;
+        m_nbMessages++;
+
+        return true;
+    }
+
+    /**
+     * @brief Write a message at the end of the FIFO
+     * @param[in] msg Message to copy or move in the FIFO
+     * @return True if the message was written, false if there is not enough space
+     */
+    template <typename M>
+    bool push(M &&msg) {
+        return emplace<std::remove_cvref_t<M>>(std::forward<M>(msg));
+    }
+
+    /**
+     * @brief Pull the first message from the FIFO: the visitor is called in place with a reference
+     * to the message, which is then destroyed.
+     * @param[in] visitor Callable accepting a reference to each of the message types
+     * @return True if a message was visited, otherwise false
+     */
+    template <typename Visitor>
+    bool pop(Visitor &&visitor) {
+        if (m_nbMessages == 0U) {
+            return false;
+        }
+
+        auto header = readHeader(m_readIdx);
+
+        if (header.tag == s_padTag) {
+            m_usedBytes -= header.recordSize;
+            m_readIdx = 0U;
+            header = readHeader(m_readIdx);
+        }
+
+        using Fn = void (*)(std::byte *, Visitor &);
+        static constexpr Fn dispatch[] = {&visitAndDestroy<Types, Visitor>...};
+        dispatch[header.tag](&m_buffer[m_readIdx + s_align], visitor);
+
+        m_readIdx = (m_readIdx + header.recordSize) % t_size;
+        m_usedBytes -= header.recordSize;
+        m_nbMessages--;
+
+        return true;
+    }
+
+  private:
+    /**
+     * @brief Tag of the records used to skip the end of the ring
+     */
+    static constexpr uint16_t s_padTag{0xFFFFU};
+
+    /**
+     * @brief Tag of a message type, its index in Types
+     */
+    template <typename M>
+    static constexpr uint16_t s_tagOf = [] {
+        constexpr bool matches[] = {std::is_same_v<M, Types>...};
+        uint16_t tag = 0U;
+        while (!matches[tag]) {
+            tag++;
+        }
+        return tag;
+    }();
+
+    template <typename M, typename Visitor>
+    static void visitAndDestroy(std::byte *payload, Visitor &visitor) {
+        auto *msg = std::launder(reinterpret_cast<M *>(payload));
+        visitor(*msg);
+        msg->~M();
+    }
+
+    void writeHeader(size_t idx, uint16_t tag, size_t recordSize) {
+        const Header header{tag, 0U, static_cast<uint32_t>(recordSize)};
+        std::memcpy(&m_buffer[idx], &header, sizeof(header));
+    }
+
+    Header readHeader(size_t idx) const {
+        Header header;
+        std::memcpy(&header, &m_buffer[idx], sizeof(header));
+        return header;
+    }
+
+    /**
+     * @brief Byte ring where the records are stored
+     */
+    alignas(s_align) std::array<std::byte, t_size> m_buffer;
+
+    /**
+     * @brief Offset of the first record to read
+     */
+    size_t m_readIdx{0U};
+
+    /**
+     * @brief Offset where the next record is written
+     */
+    size_t m_writeIdx{0U};
+
+    /**
+     * @brief Number of bytes used by records and padding
+     */
+    size_t m_usedBytes{0U};
+
+    /**
+     * @brief Current nb of messages in the FIFO
+     */
+    size_t m_nbMessages{0U};
+};
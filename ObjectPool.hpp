@@ -0,0 +1,178 @@
+/**
+ * @file ObjectPool.hpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include "FIFO.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+
+/**
+ * @brief Fixed pool of objects addressed by 32-bit handles. The free handles are kept in a Fifo,
+ * so acquiring and releasing an object only moves an index.
+ * This pool does NOT support access from concurrent threads.
+ */
+template <typename T, size_t t_size>
+class ObjectPool {
+    static_assert(t_size <= UINT32_MAX, "Pool too large for 32-bit handles");
+
+  public:
+    using Handle = uint32_t;
+
+    /**
+     * @brief Construct a new ObjectPool object, all the objects are available
+     */
+    ObjectPool() {
+        for (size_t i = 0; i < t_size; i++) {
+            m_freeList.push(static_cast<Handle>(i));
+        }
+    }
+
+    /**
+     * @brief Get current number of objects that can be acquired
+     * @return Number of available objects
+     */
+    size_t getAvailable() const { return m_freeList.getCount(); }
+
+    /**
+     * @brief Acquire an object from the pool. The object keeps the value it had when released.
+     * @param[out] handle Handle of the acquired object
+     * @return True if an object was acquired, false if the pool is exhausted
+     */
+    bool acquire(Handle *const handle) { return m_freeList.pop(handle); }
+
+    /**
+     * @brief Give an object back to the pool
+     * @warning The handle shall have been acquired and not released yet
+     * @param[in] handle Handle of the object to release
+     */
+    void release(Handle handle) {
+        assert(handle < t_size);
+        assert(m_freeList.getCount() < t_size);
+        m_freeList.push(handle);
+    }
+
+    /**
+     * @brief Access to the object of a handle
+     * @warning It's the caller responsability to use an acquired handle
+     */
+    T &operator[](Handle handle) {
+        assert(handle < t_size);
+        return m_objects[handle];
+    }
+
+    /// @copydoc operator[]
+    const T &operator[](Handle handle) const {
+        assert(handle < t_size);
+        return m_objects[handle];
+    }
+
+  private:
+    /**
+     * @brief Storage of the objects
+     */
+    std::array<T, t_size> m_objects{};
+
+    /**
+     * @brief Handles of the objects that can be acquired
+     */
+    Fifo<Handle, t_size> m_freeList{};
+};
+
+/**
+ * @brief FIFO of large objects where only handles are queued: producers acquire an object, fill
+ * it in place and push its handle; consumers pop the handle, process the object in place and
+ * release it. Each hand-off moves 4 bytes whatever the size of T.
+ * This FIFO does NOT support access from concurrent threads.
+ */
+template <typename T, size_t t_size>
+class PooledFifo {
+  public:
+    using Handle = typename ObjectPool<T, t_size>::Handle;
+
+    /**
+     * @brief Get current number of objects queued in the FIFO
+     * @return Number of queued objects
+     */
+    size_t getCount() const { return m_queue.getCount(); }
+
+    /**
+     * @brief Get current number of objects that can be acquired
+     * @return Number of available objects
+     */
+    size_t getAvailable() const { return m_pool.getAvailable(); }
+
+    /**
+     * @brief Acquire an object to fill before pushing it
+     * @param[out] handle Handle of the acquired object
+     * @return True if an object was acquired, false if all the objects are in use
+     */
+    bool acquire(Handle *const handle) { return m_pool.acquire(handle); }
+
+    /**
+     * @brief Queue an acquired object. This cannot fail as the queue can hold all the objects.
+     * @param[in] handle Handle of the object
+     */
+    void push(Handle handle) {
+        assert(handle < t_size);
+        m_queue.push(handle);
+    }
+
+    /**
+     * @brief Pull the first queued object. The object shall be released once processed.
+     * @param[out] handle Handle of the object
+     * @return True if an object was pulled, otherwise false
+     */
+    bool pop(Handle *const handle) { return m_queue.pop(handle); }
+
+    /**
+     * @brief Give a processed object back to the pool
+     * @param[in] handle Handle of the object
+     */
+    void release(Handle handle) { m_pool.release(handle); }
+
+    /**
+     * @brief Access to the object of a handle
+     * @warning It's the caller responsability to use an acquired handle
+     */
+    T &operator[](Handle handle) { return m_pool[handle]; }
+
+    /// @copydoc operator[]
+    const T &operator[](Handle handle) const { return m_pool[handle]; }
+
+  private:
+    /**
+     * @brief Objects, and the handles of the ones that are not in use
+     */
+    ObjectPool<T, t_size> m_pool{};
+
+    /**
+     * @brief Handles of the objects pushed and not popped yet
+     */
+    Fifo<Handle, t_size> m_queue{};
+};
@@ -0,0 +1,372 @@
+/**
+ * @file PackedFifo.hpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief FIFO of t_bits-bit integer samples, such as 10, 12 or 14-bit ADC samples, stored densely
+ * instead of in a whole T each. Samples are packed LSB first; slot i starts at bit i * t_bits of
+ * the storage. Values are truncated to t_bits bits on push, and sign extended on read if T is
+ * signed.
+ * The bulk push() and pull() process aligned groups of 8 samples, which span exactly t_bits bytes:
+ * a group is built or split in registers with constant shifts, and accessed in memory at once.
+ * This FIFO does NOT support access from concurrent threads.
+ */
+template <typename T, unsigned t_bits, size_t t_size>
+class PackedFifo {
+    static_assert(std::is_integral_v<T>, "Samples must be integers");
+    static_assert(t_bits > 0U && t_bits <= 32U && t_bits <= 8U * sizeof(T),
+                  "Sample width must be between 1 and 32 bits, and fit in T");
+
+  public:
+    /**
+     * @brief Get current number of samples in the FIFO
+     * @return Number of samples
+     */
+    size_t getCount() const { return m_nbElements; }
+
+    /**
+     * @brief Get current number of free slots
+     * @return Number of samples that can be pushed
+     */
+    size_t getFreeSpace() const { return t_size - m_nbElements; }
+
+    /**
+     * @brief Get the size of the packed storage
+     * @return Storage size, in bytes
+     */
+    static constexpr size_t getStorageSize() { return s_storageSize; }
+
+    /**
+     * @brief Empty the FIFO, delete all the data
+     */
+    void reset() {
+        m_readIdx = 0;
+        m_writeIdx = 0;
+        m_nbElements = 0;
+    }
+
+    /**
+     * @brief Write a single sample to the FIFO
+     * @param[in] sample Sample to write, only its t_bits low bits are kept
+     * @return True if the sample was written, otherwise false
+     */
+    bool push(T sample) {
+        if (m_nbElements == t_size) {
+            return false;
+        }
+
+        storeSlot(m_writeIdx, sample);
+        m_writeIdx = (m_writeIdx + 1U) % t_size;
+        m_nbElements++;
+
+        return true;
+    }
+
+    /**
+     * @brief Write samples to the FIFO. If there is not enough space, leave the FIFO as is.
+     * @param[in] src Source buffer to pack the samples from
+     * @return Number of samples written
+     */
+    size_t push(std::span<const T> src) {
+        if (src.size() > getFreeSpace()) {
+            return 0;
+        }
+
+        for (size_t i = 0; i < src.size();) {
+            if (isGroupStart(m_writeIdx) && src.size() - i >= s_groupSize) {
+                packGroup(m_writeIdx, src.data() + i, std::make_index_sequence<s_groupSize>{});
+                m_writeIdx = (m_writeIdx + s_groupSize) % t_size;
+                i += s_groupSize;
+            } else {
+                storeSlot(m_writeIdx, src[i]);
+                m_writeIdx = (m_writeIdx + 1U) % t_size;
+                i++;
+            }
+        }
+        m_nbElements += src.size();
+
+        return src.size();
+    }
+
+    /**
+     * @brief Read and remove the oldest sample
+     * @param[out] dest Where the sample is written
+     * @return True if a sample was read, otherwise false
+     */
+    bool pop(T *const dest) { return (pull(dest, 1) != 0); }
+
+    /**
+     * @brief Read samples from the FIFO
+     * @param[out] destination Destination buffer where the samples are unpacked to
+     * @param[in] availSpace Available space in the destination buffer, in samples
+     * @return Number of samples read
+     */
+    size_t pull(T *destination, size_t availSpace) {
+        assert(destination != nullptr);
+
+        const auto nbSamples = std::min(availSpace, m_nbElements);
+
+        for (size_t i = 0; i < nbSamples;) {
+            if (isGroupStart(m_readIdx) && nbSamples - i >= s_groupSize) {
+                unpackGroup(m_readIdx, destination + i, std::make_index_sequence<s_groupSize>{});
+                m_readIdx = (m_readIdx + s_groupSize) % t_size;
+                i += s_groupSize;
+            } else {
+                destination[i] = loadSlot(m_readIdx);
+                m_readIdx = (m_readIdx + 1U) % t_size;
+                i++;
+            }
+        }
+        m_nbElements -= nbSamples;
+
+        return nbSamples;
+    }
+
+    /**
+     * @brief Access a sample, without removing it from the FIFO
+     * @param[in] index Index of the sample, 0 being the oldest one
+     * @return Sample value
+     */
+    T operator[](size_t index) const {
+        assert(index < m_nbElements);
+        return loadSlot((m_readIdx + index) % t_size);
+    }
+
+  private:
+    /**
+     * @brief Number of samples in a group, t_bits bytes
+     */
+    static constexpr size_t s_groupSize{8U};
+
+    /**
+     * @brief Size of the packed samples, plus slack so any sample can be accessed with a single
+     * 64-bit load and store
+     */
+    static constexpr size_t s_storageSize{(t_size * t_bits + 7U) / 8U + sizeof(uint64_t)};
+
+    /**
+     * @brief Mask of the t_bits low bits
+     */
+    static constexpr uint64_t s_mask{(uint64_t{1} << t_bits) - 1U};
+
+    /**
+     * @brief Check whether a full group of samples starts at a slot, without wrapping
+     * @param[in] slot Slot index
+     */
+    static constexpr bool isGroupStart(size_t slot) {
+        return (slot % s_groupSize == 0U) && (slot + s_groupSize <= t_size);
+    }
+
+    /**
+     * @brief Convert a word between native and little-endian byte order
+     * @param[in] word Word to convert
+     */
+    static constexpr uint64_t littleEndian(uint64_t word) {
+        if constexpr (std::endian::native == std::endian::big) {
+            word = ((word & 0x00FF00FF00FF00FFU) << 8U) | ((word >> 8U) & 0x00FF00FF00FF00FFU);
+            word = ((word & 0x0000FFFF0000FFFFU) << 16U) | ((word >> 16U) & 0x0000FFFF0000FFFFU);
+            word = (word << 32U) | (word >> 32U);
+        }
+        return word;
+    }
+
+    /**
+     * @brief Get the t_bits low bits of a sample
+     * @param[in] sample Sample value
+     */
+    static constexpr uint64_t toRaw(T sample) {
+        return static_cast<uint64_t>(static_cast<std::make_unsigned_t<T>>(sample)) & s_mask;
+    }
+
+    /**
+     * @brief Get a sample from its t_bits bits, sign extended if T is signed
+     * @param[in] raw Sample bits, the other bits shall be zero
+     */
+    static constexpr T fromRaw(uint64_t raw) {
+        if constexpr (std::is_signed_v<T>) {
+            constexpr unsigned signShift = 64U - t_bits;
+            return static_cast<T>(static_cast<int64_t>(raw << signShift) >> signShift);
+        } else {
+            return static_cast<T>(raw);
+        }
+    }
+
+    /**
+     * @brief Load the 64 bits starting at a byte of the storage, as a little-endian word
+     * @param[in] byteIdx Byte index
+     */
+    uint64_t loadWord(size_t byteIdx) const {
+        uint64_t word;
+        std::memcpy(&word, m_buffer.data() + byteIdx, sizeof(word));
+        return littleEndian(word);
+    }
+
+    /**
+     * @brief Store 64 bits, as a little-endian word, starting at a byte of the storage
+     * @param[in] byteIdx Byte index
+     * @param[in] word Word to store
+     */
+    void storeWord(size_t byteIdx, uint64_t word) {
+        word = littleEndian(word);
+        std::memcpy(m_buffer.data() + byteIdx, &word, sizeof(word));
+    }
+
+    /**
+     * @brief Read a sample
+     * @param[in] byteIdx Index of the storage byte holding the first bit of the sample
+     * @param[in] shift Position of the first bit of the sample in this byte
+     */
+    T load(size_t byteIdx, size_t shift) const { return fromRaw((loadWord(byteIdx) >> shift) & s_mask); }
+
+    /**
+     * @brief Write a sample, the neighbouring bits are left as is
+     * @param[in] byteIdx Index of the storage byte holding the first bit of the sample
+     * @param[in] shift Position of the first bit of the sample in this byte
+     * @param[in] sample Sample value, truncated to t_bits bits
+     */
+    void store(size_t byteIdx, size_t shift, T sample) {
+        const auto word = loadWord(byteIdx) & ~(s_mask << shift);
+
+        storeWord(byteIdx, word | (toRaw(sample) << shift));
+    }
+
+    /**
+     * @brief Read the sample of a slot
+     * @param[in] slot Slot index
+     */
+    T loadSlot(size_t slot) const { return load(slot * t_bits / 8U, slot * t_bits % 8U); }
+
+    /**
+     * @brief Write the sample of a slot
+     * @param[in] slot Slot index
+     * @param[in] sample Sample value
+     */
+    void storeSlot(size_t slot, T sample) { store(slot * t_bits / 8U, slot * t_bits % 8U, sample); }
+
+    /**
+     * @brief Packed bits of a group of samples, in registers
+     */
+    using GroupWords = std::array<uint64_t, (s_groupSize * t_bits + 63U) / 64U>;
+
+    /**
+     * @brief Insert a sample of a group in its packed bits
+     * @param[in,out] words Packed bits of the group
+     * @param[in] sample Sample value
+     */
+    template <size_t t_idx>
+    static void packSample(GroupWords &words, T sample) {
+        constexpr size_t word = t_idx * t_bits / 64U;
+        constexpr size_t shift = t_idx * t_bits % 64U;
+        const auto raw = toRaw(sample);
+
+        words[word] |= raw << shift;
+        if constexpr (shift + t_bits > 64U) {
+            words[word + 1U] |= raw >> (64U - shift);
+        }
+    }
+
+    /**
+     * @brief Extract a sample of a group from its packed bits
+     * @param[in] words Packed bits of the group
+     * @return Sample value
+     */
+    template <size_t t_idx>
+    static T unpackSample(const GroupWords &words) {
+        constexpr size_t word = t_idx * t_bits / 64U;
+        constexpr size_t shift = t_idx * t_bits % 64U;
+        auto raw = words[word] >> shift;
+
+        if constexpr (shift + t_bits > 64U) {
+            raw |= words[word + 1U] << (64U - shift);
+        }
+        return fromRaw(raw & s_mask);
+    }
+
+    /**
+     * @brief Pack a group of samples: the t_bits bytes of the group are built in registers, with
+     * compile-time shifts, then stored at once
+     * @param[in] slot First slot of the group
+     * @param[in] src Samples to pack
+     */
+    template <size_t... t_idx>
+    void packGroup(size_t slot, const T *src, std::index_sequence<t_idx...>) {
+        GroupWords words{};
+        (packSample<t_idx>(words, src[t_idx]), ...);
+
+        for (auto &word : words) {
+            word = littleEndian(word);
+        }
+        std::memcpy(m_buffer.data() + slot / 8U * t_bits, words.data(), t_bits);
+    }
+
+    /**
+     * @brief Unpack a group of samples: the t_bits bytes of the group are loaded at once, then
+     * split with compile-time shifts
+     * @param[in] slot First slot of the group
+     * @param[out] dest Where the samples are written
+     */
+    template <size_t... t_idx>
+    void unpackGroup(size_t slot, T *dest, std::index_sequence<t_idx...>) const {
+        GroupWords words{};
+        std::memcpy(words.data(), m_buffer.data() + slot / 8U * t_bits, t_bits);
+
+        for (auto &word : words) {
+            word = littleEndian(word);
+        }
+        ((dest[t_idx] = unpackSample<t_idx>(words)), ...);
+    }
+
+    /**
+     * @brief Container where the samples are packed
+     */
+    std::array<uint8_t, s_storageSize> m_buffer{};
+
+    /**
+     * @brief Current read index, slot of the oldest sample
+     */
+    size_t m_readIdx{0U};
+
+    /**
+     * @brief Current write index, slot of the next sample to write
+     */
+    size_t m_writeIdx{0U};
+
+    /**
+     * @brief Current number of samples in the FIFO
+     */
+    size_t m_nbElements{0U};
+};
@@ -0,0 +1,84 @@
+/**
+ * @file SpinLock.hpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+
+/**
+ * @brief Minimal test-and-test-and-set spin lock, meant to guard very short critical sections
+ * such as a push or a pop on a Fifo. It satisfies the Lockable requirements so it can be used
+ * with std::lock_guard and std::unique_lock.
+ */
+class SpinLock {
+  public:
+    SpinLock() = default;
+    SpinLock(const SpinLock &) = delete;
+    SpinLock &operator=(const SpinLock &) = delete;
+
+    /**
+     * @brief Acquire the lock, busy-waiting until it is available
+     */
+    void lock() noexcept {
+        while (m_flag.test_and_set(std::memory_order_acquire)) {
+            // spin on a plain load to keep the cache line shared while the lock is held
+            while (m_flag.test(std::memory_order_relaxed)) {
+                relax();
+            }
+        }
+    }
+
+    /**
+     * @brief Try to acquire the lock without waiting
+     * @return True if the lock was acquired, otherwise false
+     */
+    bool try_lock() noexcept {
+        return (!m_flag.test(std::memory_order_relaxed)) &&
+               (!m_flag.test_and_set(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Release the lock
+     */
+    void unlock() noexcept { m_flag.clear(std::memory_order_release); }
+
+    /**
+     * @brief Hint the CPU that the caller is in a spin-wait loop
+     */
+    static void relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+  private:
+    /**
+     * @brief Lock state, set while the lock is held
+     */
+    std::atomic_flag m_flag{};
+};
@@ -0,0 +1,416 @@
+/**
+ * @file ThreadPool.hpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include "FIFO.hpp"
+#include "SpinLock.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+
+/**
+ * @brief Move-only callable stored inline, without any heap allocation.
+ * The callable must fit in t_capacity bytes and be nothrow move constructible.
+ */
+template <size_t t_capacity = 64>
+class InlineTask {
+  public:
+    /**
+     * @brief Construct an empty task
+     */
+    InlineTask() = default;
+
+    /**
+     * @brief Construct a task from any callable taking no argument
+     * @param[in] fn Callable moved (or copied) in the inline storage
+     */
+    template <typename F>
+        requires(!std::is_same_v<std::decay_t<F>, InlineTask> && std::is_invocable_v<std::decay_t<F> &>)
+    InlineTask(F &&fn) {
+        using Fn = std::decay_t<F>;
+        static_assert(sizeof(Fn) <= t_capacity, "Callable does not fit in the inline task storage");
+        static_assert(alignof(Fn) <= alignof(std::max_align_t), "Callable alignment is not supported");
+        static_assert(std::is_nothrow_move_constructible_v<Fn>, "Callable shall be nothrow movable");
+
+        ::new (static_cast<void *>(m_storage)) Fn(std::forward<F>(fn));
+        m_ops = &s_ops<Fn>;
+    }
+
+    InlineTask(const InlineTask &) = delete;
+    InlineTask &operator=(const InlineTask &) = delete;
+
+    InlineTask(InlineTask &&other) noexcept { moveFrom(other); }
+
+    InlineTask &operator=(InlineTask &&other) noexcept {
+        if (this != &other) {
+            clear();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    ~InlineTask() { clear(); }
+
+    /// @brief True if the task holds a callable
+    explicit operator bool() const { return m_ops != nullptr; }
+
+    /**
+     * @brief Invoke the stored callable
+     * @warning The task shall not be empty
+     */
+    void operator()() {
+        assert(m_ops != nullptr);
+        m_ops->invoke(m_storage);
+    }
+
+  private:
+    /**
+     * @brief Type-erased operations on the stored callable
+     */
+    struct Ops {
+        void (*invoke)(void *);
+        void (*relocate)(void *dst, void *src);
+        void (*destroy)(void *);
+    };
+
+    template <typename Fn>
+    static constexpr Ops s_ops{
+        [](void *obj) { (*static_cast<Fn *>(obj))(); },
+        [](void *dst, void *src) {
+            ::new (dst) Fn(std::move(*static_cast<Fn *>(src)));
+            static_cast<Fn *>(src)->~Fn();
+        },
+        [](void *obj) { static_cast<Fn *>(obj)->~Fn(); }};
+
+    void moveFrom(InlineTask &other) noexcept {
+        if (other.m_ops != nullptr) {
+            other.m_ops->relocate(m_storage, other.m_storage);
+            m_ops = std::exchange(other.m_ops, nullptr);
+        }
+    }
+
+    void clear() noexcept {
+        if (m_ops != nullptr) {
+            m_ops->destroy(m_storage);
+            m_ops = nullptr;
+        }
+    }
+
+    /**
+     * @brief Inline storage of the callable
+     */
+    alignas(std::max_align_t) std::byte m_storage[t_capacity];
+
+    /**
+     * @brief Operations of the stored callable, nullptr when the task is empty
+     */
+    const Ops *m_ops{nullptr};
+};
+
+/**
+ * @brief Thread pool for short tasks. Each worker owns a static Fifo of inline tasks, so
+ * submitting a task never allocates. Idle workers steal from the other queues before spinning,
+ * then sleep.
+ * @warning Tasks still queued when the pool is destroyed are executed before the workers exit.
+ */
+template <size_t t_queueSize = 256, size_t t_taskSize = 64>
+class ThreadPool {
+  public:
+    using Task = InlineTask<t_taskSize>;
+
+    /**
+     * @brief Construct the pool and start the workers
+     * @param[in] nbWorkers Number of worker threads, at least 1
+     */
+    explicit ThreadPool(size_t nbWorkers = std::thread::hardware_concurrency())
+        : m_nbWorkers(std::max<size_t>(nbWorkers, 1U)),
+          m_workers(std::make_unique<Worker[]>(m_nbWorkers)) {
+        for (size_t i = 0; i < m_nbWorkers; i++) {
+            m_workers[i].thread = std::thread([this, i] { run(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief Execute the remaining tasks, then stop and join the workers
+     */
+    ~ThreadPool() {
+        m_stop.store(true);
+        m_epoch.fetch_add(1);
+        m_epoch.notify_all();
+
+        for (size_t i = 0; i < m_nbWorkers; i++) {
+            m_workers[i].thread.join();
+        }
+    }
+
+    /// @brief Number of worker threads
+    size_t getNbWorkers() const { return m_nbWorkers; }
+
+    /**
+     * @brief Submit a single task. Queues are filled in a round-robin way.
+     * The callable is only moved from once a free slot is found: if all the queues are full, it
+     * is left as is and can be submitted again.
+     * @param[in] fn Callable to execute, shall fit in the inline task storage
+     * @return True if the task was queued, false if all the queues are full or the task is empty
+     */
+    template <typename F>
+    bool submit(F &&fn) {
+        if constexpr (std::is_same_v<std::decay_t<F>, Task>) {
+            if (!fn) {
+                return false;
+            }
+        }
+
+        const auto first = m_nextQueue.value.fetch_add(1, std::memory_order_relaxed);
+
+        for (size_t i = 0; i < m_nbWorkers; i++) {
+            auto &worker = m_workers[(first + i) % m_nbWorkers];
+            std::unique_lock lock(worker.lock);
+
+            if (worker.queue.getCount() < t_queueSize) {
+                m_pending.value.fetch_add(1, std::memory_order_relaxed);
+                m_queued.value.fetch_add(1);
+                worker.queue.push(Task(std::forward<F>(fn)));
+                lock.unlock();
+
+                wakeUp();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Submit several tasks at once. Each queue is locked once and filled with as many
+     * tasks as it can take. The submitted tasks are moved from and left empty, the other ones are
+     * left as is. Submission stops at the first empty task.
+     * @param[in] tasks Tasks to execute
+     * @return Number of tasks queued, the first ones of the span
+     */
+    size_t submit(std::span<Task> tasks) {
+        const auto nbTasks = static_cast<size_t>(
+            std::find_if(tasks.begin(), tasks.end(), [](const Task &task) { return !task; }) - tasks.begin());
+        const auto first = m_nextQueue.value.fetch_add(1, std::memory_order_relaxed);
+        size_t nbSubmitted = 0U;
+
+        m_pending.value.fetch_add(nbTasks, std::memory_order_relaxed);
+        m_queued.value.fetch_add(nbTasks);
+
+        size_t nbQueues = 0U;
+        for (size_t i = 0; (i < m_nbWorkers) && (nbSubmitted < nbTasks); i++) {
+            auto &worker = m_workers[(first + i) % m_nbWorkers];
+            std::lock_guard lock(worker.lock);
+
+            const auto nbBefore = nbSubmitted;
+            while ((nbSubmitted < nbTasks) && (worker.queue.getCount() < t_queueSize)) {
+                worker.queue.push(std::move(tasks[nbSubmitted]));
+                nbSubmitted++;
+            }
+            nbQueues += (nbSubmitted != nbBefore) ? 1U : 0U;
+        }
+
+        m_queued.value.fetch_sub(nbTasks - nbSubmitted, std::memory_order_relaxed);
+        m_pending.value.fetch_sub(nbTasks - nbSubmitted, std::memory_order_relaxed);
+
+        if (nbSubmitted > 0) {
+            wakeUp(nbQueues);
+        }
+
+        return nbSubmitted;
+    }
+
+    /**
+     * @brief Wait until all the submitted tasks have been executed
+     */
+    void waitIdle() const {
+        while (m_pending.value.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+  private:
+    /**
+     * @brief Number of empty polls a worker does before going to sleep
+     */
+    static constexpr size_t s_spinCount{4096U};
+
+    /**
+     * @brief Worker state, aligned to avoid false sharing between queues
+     */
+    struct alignas(64) Worker {
+        SpinLock lock;
+        Fifo<Task, t_queueSize> queue;
+        std::thread thread;
+    };
+
+    /**
+     * @brief Atomic counter alone on its cache line, so that the counters written on every
+     * submission do not bounce the same line between submitters and workers
+     */
+    template <typename U>
+    struct alignas(64) PaddedAtomic {
+        std::atomic<U> value{0U};
+    };
+
+    /**
+     * @brief Wake up sleeping workers, if any. The epoch is only bumped when a worker is about
+     * to sleep: m_queued is incremented before m_sleepers is read, and a worker increments
+     * m_sleepers before it reads m_queued, both sequentially consistent, so either the submitter
+     * sees the sleeper or the sleeper sees the task.
+     * @param[in] nbQueues Number of queues that received tasks, as many workers are woken up
+     */
+    void wakeUp(size_t nbQueues = 1U) {
+        const auto nbSleepers = m_sleepers.load();
+
+        if (nbSleepers > 0) {
+            m_epoch.fetch_add(1, std::memory_order_release);
+            for (size_t i = 0; i < std::min(nbQueues, nbSleepers); i++) {
+                m_epoch.notify_one();
+            }
+        }
+    }
+
+    /**
+     * @brief Pop a task from the worker's own queue, or steal one from another queue
+     * @param[in] self Index of the calling worker
+     * @param[out] task Where the task is moved to
+     * @return True if a task was found, otherwise false
+     */
+    bool tryPop(size_t self, Task &task) {
+        {
+            std::lock_guard lock(m_workers[self].lock);
+            if (m_workers[self].queue.pop(&task)) {
+                m_queued.value.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        for (size_t i = 1; i < m_nbWorkers; i++) {
+            auto &victim = m_workers[(self + i) % m_nbWorkers];
+            std::unique_lock lock(victim.lock, std::try_to_lock);
+
+            if (lock.owns_lock() && victim.queue.pop(&task)) {
+                m_queued.value.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Worker loop: execute, steal, spin, then sleep until new tasks are submitted
+     * @param[in] self Index of the worker
+     */
+    void run(size_t self) {
+        Task task;
+        size_t idleSpins = 0U;
+
+        while (true) {
+            if (tryPop(self, task)) {
+                task();
+                task = Task{};
+                m_pending.value.fetch_sub(1, std::memory_order_release);
+                idleSpins = 0U;
+            } else if (idleSpins < s_spinCount) {
+                // yield from time to time so that spinning workers do not starve the submitters
+                // when there are fewer cores than threads
+                if ((++idleSpins % 64U) == 0U) {
+                    std::this_thread::yield();
+                } else {
+                    SpinLock::relax();
+                }
+            } else {
+                idleSpins = 0U;
+                const auto epoch = m_epoch.load(std::memory_order_acquire);
+                m_sleepers.fetch_add(1);
+
+                if (m_queued.value.load() == 0) {
+                    if (m_stop.load()) {
+                        m_sleepers.fetch_sub(1);
+                        return;
+                    }
+                    m_epoch.wait(epoch);
+                }
+
+                m_sleepers.fetch_sub(1);
+            }
+        }
+    }
+
+    /**
+     * @brief Number of worker threads
+     */
+    const size_t m_nbWorkers;
+
+    /**
+     * @brief Workers, each one with its own task queue
+     */
+    std::unique_ptr<Worker[]> m_workers;
+
+    /**
+     * @brief Next queue used by submit, for round-robin distribution
+     */
+    PaddedAtomic<size_t> m_nextQueue{};
+
+    /**
+     * @brief Number of tasks submitted and not executed yet
+     */
+    PaddedAtomic<size_t> m_pending{};
+
+    /**
+     * @brief Number of tasks waiting in the queues
+     */
+    PaddedAtomic<size_t> m_queued{};
+
+    /**
+     * @brief Incremented on submissions while workers sleep, sleeping workers wait on it. Kept
+     * with the other sleep-related members, only written on the sleep and wake-up paths.
+     */
+    alignas(64) std::atomic<uint32_t> m_epoch{0U};
+
+    /**
+     * @brief Number of workers about to sleep or sleeping
+     */
+    std::atomic<size_t> m_sleepers{0U};
+
+    /**
+     * @brief Set when the pool is destroyed
+     */
+    std::atomic<bool> m_stop{false};
+};
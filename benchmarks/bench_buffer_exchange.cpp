@@ -0,0 +1,141 @@
+/**
+ * @file bench_buffer_exchange.cpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Producer/consumer throughput with large buffers:
+ * - BufferExchange: fixed buffer set recycled through the free and full rings
+ * - reference: each buffer is malloc'd by the producer, passed through a Fifo of pointers and
+ *   freed by the consumer
+ */
+
+#include "../BufferExchange.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr size_t BUFFER_SIZE{64U * 1024U};
+static constexpr size_t NB_BUFFERS{8U};
+static constexpr size_t NB_TRANSFERS{200000U};
+
+using Buffer = std::array<unsigned char, BUFFER_SIZE>;
+
+static double toGBps(Clock::duration elapsed) {
+    const std::chrono::duration<double> seconds = elapsed;
+    return static_cast<double>(BUFFER_SIZE * NB_TRANSFERS) / seconds.count() / 1e9;
+}
+
+static double benchExchange() {
+    auto exchange = std::make_unique<BufferExchange<Buffer, NB_BUFFERS>>();
+    const auto start = Clock::now();
+
+    std::thread producer([&exchange] {
+        for (size_t i = 0; i < NB_TRANSFERS; i++) {
+            auto lease = exchange->acquire();
+            while (!lease) {
+                std::this_thread::yield();
+                lease = exchange->acquire();
+            }
+            std::memset(lease->data(), static_cast<int>(i), BUFFER_SIZE);
+            exchange->submit(std::move(lease));
+        }
+    });
+
+    size_t checksum = 0U;
+    for (size_t i = 0; i < NB_TRANSFERS;) {
+        auto lease = exchange->receive();
+        if (lease) {
+            checksum += (*lease)[BUFFER_SIZE - 1U];
+            exchange->release(std::move(lease));
+            i++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    const auto elapsed = Clock::now() - start;
+    std::printf("  checksum %zu\n", checksum);
+    return toGBps(elapsed);
+}
+
+static double benchMalloc() {
+    Fifo<unsigned char *, NB_BUFFERS> full{};
+    SpinLock lock{};
+    const auto start = Clock::now();
+
+    std::thread producer([&full, &lock] {
+        for (size_t i = 0; i < NB_TRANSFERS;) {
+            auto *buffer = static_cast<unsigned char *>(std::malloc(BUFFER_SIZE));
+            std::memset(buffer, static_cast<int>(i), BUFFER_SIZE);
+
+            bool pushed = false;
+            while (!pushed) {
+                {
+                    std::lock_guard guard(lock);
+                    pushed = full.push(buffer);
+                }
+                if (!pushed) {
+                    std::this_thread::yield();
+                }
+            }
+            i++;
+        }
+    });
+
+    size_t checksum = 0U;
+    for (size_t i = 0; i < NB_TRANSFERS;) {
+        unsigned char *buffer = nullptr;
+        bool popped;
+        {
+            std::lock_guard guard(lock);
+            popped = full.pop(&buffer);
+        }
+        if (popped) {
+            checksum += buffer[BUFFER_SIZE - 1U];
+            std::free(buffer);
+            i++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    const auto elapsed = Clock::now() - start;
+    std::printf("  checksum %zu\n", checksum);
+    return toGBps(elapsed);
+}
+
+int main() {
+    std::printf("BufferExchange : %6.2f GB/s\n", benchExchange());
+    std::printf("malloc/free    : %6.2f GB/s\n", benchMalloc());
+    return 0;
+}
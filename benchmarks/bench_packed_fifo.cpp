@@ -0,0 +1,109 @@
+/**
+ * @file bench_packed_fifo.cpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Push/pull throughput of 12-bit samples:
+ * - PackedFifo bulk: aligned groups of 8 samples packed and unpacked in registers
+ * - PackedFifo single: one read-modify-write of a 64-bit word per sample
+ * - reference: Fifo of int16_t, no packing
+ */
+
+#include "../FIFO.hpp"
+#include "../PackedFifo.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr size_t FIFO_SIZE{4096U};
+static constexpr size_t BLOCK_SIZE{1024U};
+static constexpr size_t NB_ROUNDS{20000U};
+
+static double toNsPerSample(Clock::duration elapsed) {
+    const std::chrono::duration<double, std::nano> ns = elapsed;
+    return ns.count() / static_cast<double>(BLOCK_SIZE * NB_ROUNDS);
+}
+
+static std::vector<int16_t> makeSamples() {
+    std::vector<int16_t> samples(BLOCK_SIZE);
+    for (size_t i = 0; i < samples.size(); i++) {
+        samples[i] = static_cast<int16_t>(static_cast<int>(i * 37U % 4096U) - 2048);
+    }
+    return samples;
+}
+
+template <typename Fifo>
+static double benchBulk(Fifo &fifo) {
+    const auto samples = makeSamples();
+    std::vector<int16_t> out(BLOCK_SIZE);
+    long checksum = 0;
+    const auto start = Clock::now();
+
+    for (size_t round = 0; round < NB_ROUNDS; round++) {
+        fifo.push(std::span<const int16_t>{samples});
+        fifo.pull(out.data(), out.size());
+        checksum += out[round % BLOCK_SIZE];
+    }
+
+    const auto elapsed = Clock::now() - start;
+    std::printf("  checksum %ld\n", checksum);
+    return toNsPerSample(elapsed);
+}
+
+static double benchSingle() {
+    auto fifo = std::make_unique<PackedFifo<int16_t, 12, FIFO_SIZE>>();
+    const auto samples = makeSamples();
+    std::vector<int16_t> out(BLOCK_SIZE);
+    long checksum = 0;
+    const auto start = Clock::now();
+
+    for (size_t round = 0; round < NB_ROUNDS; round++) {
+        for (const auto sample : samples) {
+            fifo->push(sample);
+        }
+        for (auto &sample : out) {
+            fifo->pop(&sample);
+        }
+        checksum += out[round % BLOCK_SIZE];
+    }
+
+    const auto elapsed = Clock::now() - start;
+    std::printf("  checksum %ld\n", checksum);
+    return toNsPerSample(elapsed);
+}
+
+int main() {
+    auto packed = std::make_unique<PackedFifo<int16_t, 12, FIFO_SIZE>>();
+    auto reference = std::make_unique<Fifo<int16_t, FIFO_SIZE>>();
+
+    std::printf("PackedFifo bulk   : %6.2f ns/sample\n", benchBulk(*packed));
+    std::printf("PackedFifo single : %6.2f ns/sample\n", benchSingle());
+    std::printf("Fifo<int16_t>     : %6.2f ns/sample\n", benchBulk(*reference));
+    return 0;
+}
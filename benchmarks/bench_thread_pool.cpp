@@ -0,0 +1,168 @@
+/**
+ * @file bench_thread_pool.cpp
+ * @author aurelien.dhiver@outlook.fr
+ *
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Compare ThreadPool against a classic pool made of a std::deque of std::function guarded by a
+ * mutex and a condition variable:
+ * - throughput: time to submit and execute a large number of empty tasks
+ * - latency: time between the submission of a task and the start of its execution, one task at
+ *   a time
+ */
+
+#include "../ThreadPool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Reference pool: single shared queue, one allocation per std::function that does not
+ * fit in its small buffer
+ */
+class MutexPool {
+  public:
+    explicit MutexPool(size_t nbWorkers) {
+        for (size_t i = 0; i < nbWorkers; i++) {
+            m_threads.emplace_back([this] { run(); });
+        }
+    }
+
+    ~MutexPool() {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        for (auto &thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    template <typename F>
+    bool submit(F &&fn) {
+        m_pending.fetch_add(1);
+        {
+            std::lock_guard lock(m_mutex);
+            m_tasks.emplace_back(std::forward<F>(fn));
+        }
+        m_cv.notify_one();
+        return true;
+    }
+
+    void waitIdle() const {
+        while (m_pending.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+  private:
+    void run() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(m_mutex);
+                m_cv.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+                if (m_tasks.empty()) {
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            task();
+            m_pending.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<std::function<void()>> m_tasks;
+    std::vector<std::thread> m_threads;
+    std::atomic<size_t> m_pending{0U};
+    bool m_stop{false};
+};
+
+template <typename Pool>
+double benchThroughput(Pool &pool, size_t nbTasks) {
+    std::atomic<size_t> counter{0U};
+    const auto start = Clock::now();
+
+    for (size_t i = 0; i < nbTasks; i++) {
+        while (!pool.submit([&counter] { counter.fetch_add(1, std::memory_order_relaxed); })) {
+            std::this_thread::yield();
+        }
+    }
+    pool.waitIdle();
+
+    const std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+    return elapsed.count() / static_cast<double>(nbTasks);
+}
+
+template <typename Pool>
+double benchLatency(Pool &pool, size_t nbTasks) {
+    std::vector<double> latencies;
+    latencies.reserve(nbTasks);
+
+    for (size_t i = 0; i < nbTasks; i++) {
+        std::atomic<Clock::rep> startedAt{0};
+        const auto submittedAt = Clock::now();
+
+        pool.submit([&startedAt] {
+            startedAt.store(Clock::now().time_since_epoch().count(), std::memory_order_release);
+        });
+        pool.waitIdle();
+
+        const auto started = Clock::time_point(Clock::duration(startedAt.load()));
+        latencies.push_back(std::chrono::duration<double, std::nano>(started - submittedAt).count());
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    return latencies[latencies.size() / 2];
+}
+
+int main() {
+    static constexpr size_t NB_WORKERS{4U};
+    static constexpr size_t NB_TASKS{1000000U};
+    static constexpr size_t NB_LATENCY_SAMPLES{100000U};
+
+    {
+        ThreadPool<1024> pool(NB_WORKERS);
+        std::printf("ThreadPool : %8.1f ns/task throughput, %8.1f ns median submit-to-start\n",
+                    benchThroughput(pool, NB_TASKS), benchLatency(pool, NB_LATENCY_SAMPLES));
+    }
+    {
+        MutexPool pool(NB_WORKERS);
+        std::printf("MutexPool  : %8.1f ns/task throughput, %8.1f ns median submit-to-start\n",
+                    benchThroughput(pool, NB_TASKS), benchLatency(pool, NB_LATENCY_SAMPLES));
+    }
+
+    return 0;
+}
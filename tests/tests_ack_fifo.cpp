@@ -0,0 +1,80 @@
+/**
+ * @file tests_ack_fifo.cpp
+ * @author aurelien.dhiver@outlook.fr
+ * 
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "../AckFifo.hpp"
+
+#include "doctest.h"
+
+TEST_CASE("test_ack_fifo_pull_and_ack") {
+    AckFifo<int, 4> fifo{};
+    std::array<int, 4> buffer{};
+
+    CHECK(fifo.push({1, 2, 3}) == 3);
+    CHECK(fifo.pull(buffer.data(), 2) == 2);
+    CHECK(buffer[0] == 1);
+    CHECK(buffer[1] == 2);
+    CHECK(fifo.getCount() == 1);
+    CHECK(fifo.getInFlight() == 2);
+    CHECK_MESSAGE(fifo.getFreeSpace() == 1, "In-flight elements still take space");
+    CHECK(fifo.push({4, 5}) == 0);
+
+    CHECK(fifo.ack(1) == 1);
+    CHECK(fifo.getInFlight() == 1);
+    CHECK(fifo.push({4, 5}) == 2);
+
+    CHECK(fifo.ack(10) == 1);
+    CHECK(fifo.getInFlight() == 0);
+    CHECK(fifo.getCount() == 3);
+
+    CHECK(fifo.pull(buffer.data(), 4) == 3);
+    CHECK(buffer == std::array<int, 4>{3, 4, 5, 0});
+    CHECK(fifo.ackAll() == 3);
+    CHECK(fifo.getFreeSpace() == 4);
+}
+
+TEST_CASE("test_ack_fifo_nack_redelivers") {
+    AckFifo<int, 4> fifo{};
+    int value;
+
+    CHECK(fifo.push({1, 2, 3, 4}) == 4);
+    CHECK(fifo.pop(&value));
+    CHECK(fifo.ack(1) == 1);
+    CHECK(fifo.push(5));
+
+    CHECK(fifo.pop(&value));
+    CHECK(value == 2);
+    CHECK(fifo.pop(&value));
+    CHECK(value == 3);
+    CHECK(fifo.nack() == 2);
+    CHECK(fifo.getInFlight() == 0);
+    CHECK(fifo.getCount() == 4);
+
+    std::array<int, 4> buffer{};
+    CHECK(fifo.pull(buffer.data(), 4) == 4);
+    CHECK(buffer == std::array<int, 4>{2, 3, 4, 5});
+    CHECK_FALSE(fifo.pop(&value));
+    CHECK_FALSE(fifo.push(6));
+}
@@ -0,0 +1,88 @@
+/**
+ * @file tests_bitstream_fifo.cpp
+ * @author aurelien.dhiver@outlook.fr
+ * 
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "../BitstreamFifo.hpp"
+
+#include "doctest.h"
+
+
+TEST_CASE("test_bitstream_fifo_fields") {
+    BitstreamFifo<16> fifo{};
+
+    CHECK(fifo.getFreeSpace() == 128);
+    CHECK(fifo.put_bits(0b101, 3));
+    CHECK(fifo.put_bits(0xABCD, 16));
+    CHECK(fifo.put_bits(0xFFFFFFFF, 1));
+    CHECK(fifo.put_bits(0xDEADBEEF, 32));
+    CHECK(fifo.getCount() == 52);
+    CHECK(fifo.getFreeSpace() == 76);
+
+    CHECK(fifo.peek_bits(3) == 0b101);
+    CHECK(fifo.get_bits(3) == 0b101u);
+    CHECK(fifo.get_bits(16) == 0xABCDu);
+    CHECK(fifo.get_bits(1) == 1u);
+    CHECK(fifo.get_bits(32) == 0xDEADBEEFu);
+    CHECK(fifo.getCount() == 0);
+    CHECK_FALSE(fifo.get_bits(1).has_value());
+
+    CHECK(fifo.put_bits(0b11, 2));
+    CHECK_MESSAGE(fifo.peek_bits(4) == 0b1100, "Missing bits are read as zeros");
+    CHECK(fifo.get_bits(1) == 1u);
+    CHECK_MESSAGE(fifo.flush() == 2, "54 bits were written so far");
+    CHECK(fifo.getCount() == 3);
+    CHECK(fifo.skip_bits(10) == 3);
+    CHECK(fifo.flush() == 0);
+    CHECK(fifo.put_bits(0x5, 4));
+    CHECK(fifo.get_bits(4) == 0x5u);
+}
+
+TEST_CASE("test_bitstream_fifo_full_and_wrap") {
+    BitstreamFifo<8> fifo{};
+
+    for (int i = 0; i < 8; i++) {
+        CHECK(fifo.put_bits(0x1FF, 8));
+    }
+    CHECK(fifo.getFreeSpace() == 0);
+    CHECK_FALSE(fifo.put_bits(1, 1));
+    fifo.reset();
+
+    // 6-byte ring: the second 32-bit word is flushed across the end of the ring
+    BitstreamFifo<6> ring{};
+    CHECK(ring.put_bits(0xAABBCCDD, 32));
+    CHECK(ring.get_bits(8) == 0xAAu);
+    CHECK(ring.put_bits(0x123, 12));
+    CHECK(ring.put_bits(0xABCDE, 20));
+    CHECK(ring.put_bits(0x55, 7));
+    CHECK(ring.getFreeSpace() == 9);
+    CHECK(ring.getCount() == 24 + 32 + 7);
+
+    CHECK(ring.get_bits(24) == 0xBBCCDDu);
+    CHECK(ring.peek_bits(32) == 0x123ABCDEu);
+    CHECK(ring.get_bits(12) == 0x123u);
+    CHECK(ring.get_bits(20) == 0xABCDEu);
+    CHECK_MESSAGE(ring.get_bits(7) == 0x55u, "Read from the write accumulator");
+    CHECK(ring.getCount() == 0);
+}
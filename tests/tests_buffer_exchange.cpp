@@ -0,0 +1,133 @@
+/**
+ * @file tests_buffer_exchange.cpp
+ * @author aurelien.dhiver@outlook.fr
+ * 
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "../BufferExchange.hpp"
+
+#include "doctest.h"
+
+#include <thread>
+
+TEST_CASE("test_buffer_exchange_round_trip") {
+    using Exchange = BufferExchange<std::array<int, 16>, 2>;
+    Exchange exchange{};
+
+    auto first = exchange.acquire();
+    auto second = exchange.acquire();
+    REQUIRE(first);
+    REQUIRE(second);
+    CHECK_FALSE_MESSAGE(exchange.acquire(), "All the buffers are leased");
+    CHECK(&*first != &*second);
+
+    (*first)[0] = 1;
+    (*second)[0] = 2;
+    CHECK(exchange.submit(std::move(first)));
+    CHECK(exchange.submit(std::move(second)));
+    CHECK_FALSE(first);
+    CHECK_FALSE(second);
+
+    auto received = exchange.receive();
+    REQUIRE(received);
+    CHECK((*received)[0] == 1);
+    CHECK(exchange.release(std::move(received)));
+    CHECK_FALSE(received);
+
+    received = exchange.receive();
+    REQUIRE(received);
+    CHECK(received->at(0) == 2);
+    CHECK_FALSE(exchange.receive());
+}
+
+TEST_CASE("test_buffer_exchange_lease_not_lost") {
+    BufferExchange<int, 1> exchange{};
+    {
+        auto lease = exchange.acquire();
+        REQUIRE(lease);
+        CHECK_FALSE(exchange.acquire());
+    }
+    CHECK_MESSAGE(exchange.acquire(), "A dropped lease is given back to the free ring");
+
+    auto lease = exchange.acquire();
+    auto other = std::move(lease);
+    CHECK_FALSE(lease);
+    other = decltype(exchange)::Lease{};
+    CHECK_MESSAGE(exchange.acquire(), "An overwritten lease is given back to the free ring");
+}
+
+TEST_CASE("test_buffer_exchange_rejects_foreign_leases") {
+    // Runtime checks, not asserts: the behavior is the same in NDEBUG builds
+    using Exchange = BufferExchange<int, 2>;
+    Exchange exchange{};
+    Exchange other{};
+
+    auto first = exchange.acquire();
+    auto second = exchange.acquire();
+    REQUIRE(second);
+
+    CHECK_FALSE(exchange.submit(Exchange::Lease{}));
+    CHECK_FALSE(exchange.release(Exchange::Lease{}));
+    CHECK_FALSE_MESSAGE(exchange.receive(), "An empty lease does not hand out a leased buffer");
+
+    auto foreign = other.acquire();
+    REQUIRE(foreign);
+    CHECK_FALSE(exchange.submit(std::move(foreign)));
+    CHECK_FALSE(exchange.release(std::move(foreign)));
+    CHECK_MESSAGE(foreign, "A rejected lease is left as is");
+    CHECK_FALSE(exchange.receive());
+
+    CHECK(other.submit(std::move(foreign)));
+    CHECK_MESSAGE(other.receive(), "The other exchange keeps its buffer");
+}
+
+TEST_CASE("test_buffer_exchange_two_threads") {
+    static constexpr int NB_ITERATIONS{10000};
+    BufferExchange<int, 4> exchange{};
+
+    std::thread producer([&exchange] {
+        for (int i = 0; i < NB_ITERATIONS; i++) {
+            auto lease = exchange.acquire();
+            while (!lease) {
+                std::this_thread::yield();
+                lease = exchange.acquire();
+            }
+            *lease = i;
+            exchange.submit(std::move(lease));
+        }
+    });
+
+    int expected = 0;
+    while (expected < NB_ITERATIONS) {
+        auto lease = exchange.receive();
+        if (lease) {
+            CHECK(*lease == expected);
+            expected++;
+            exchange.release(std::move(lease));
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+}
@@ -0,0 +1,123 @@
+/**
+ * @file tests_cancellable_fifo.cpp
+ * @author aurelien.dhiver@outlook.fr
+ * 
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "../CancellableFifo.hpp"
+
+#include "doctest.h"
+
+#include <memory>
+#include <vector>
+
+TEST_CASE("test_cancellable_fifo_cancel") {
+    CancellableFifo<int, 4> fifo{};
+    std::vector<CancellableFifo<int, 4>::Handle> handles;
+
+    for (int i = 0; i < 4; i++) {
+        auto handle = fifo.push(i);
+        REQUIRE(handle.has_value());
+        handles.push_back(*handle);
+    }
+    CHECK_FALSE(fifo.push(4).has_value());
+
+    CHECK(fifo.cancel(handles[0]));
+    CHECK(fifo.cancel(handles[2]));
+    CHECK_FALSE_MESSAGE(fifo.cancel(handles[2]), "Entry already cancelled");
+    CHECK(fifo.getCount() == 2);
+    CHECK(fifo.getTombstones() == 2);
+    CHECK(fifo.getOccupancy() == 4);
+
+    int value;
+    CHECK(fifo.pop(&value));
+    CHECK(value == 1);
+    CHECK_FALSE_MESSAGE(fifo.cancel(handles[1]), "Entry already read");
+    CHECK(fifo.getTombstones() == 1);
+
+    CHECK(fifo.pop(&value));
+    CHECK(value == 3);
+    CHECK_FALSE(fifo.pop(&value));
+    CHECK(fifo.getOccupancy() == 0);
+    CHECK(fifo.getTombstones() == 0);
+}
+
+TEST_CASE("test_cancellable_fifo_stale_handle") {
+    CancellableFifo<int, 2> fifo{};
+    int value;
+
+    auto first = fifo.push(1);
+    REQUIRE(first.has_value());
+    CHECK(fifo.pop(&value));
+    CHECK(fifo.push(2).has_value());
+    auto reused = fifo.push(3);
+    REQUIRE(reused.has_value());
+    CHECK(reused->index == first->index);
+
+    CHECK_FALSE_MESSAGE(fifo.cancel(*first), "Slot reused by a newer entry");
+    CHECK(fifo.cancel(*reused));
+    CHECK_FALSE(fifo.cancel({7, 0}));
+
+    CHECK(fifo.pop(&value));
+    CHECK(value == 2);
+    CHECK_FALSE(fifo.pop(&value));
+}
+
+TEST_CASE("test_cancellable_fifo_bulk_skip") {
+    static constexpr size_t SIZE{150U};
+    CancellableFifo<size_t, SIZE> fifo{};
+    std::vector<CancellableFifo<size_t, SIZE>::Handle> handles;
+    std::array<size_t, SIZE> buffer{};
+
+    // start close to the end of the ring so that the run of tombstones wraps
+    for (size_t i = 0; i < 140; i++) {
+        fifo.push(i);
+    }
+    CHECK(fifo.pull(buffer.data(), 140) == 140);
+
+    for (size_t i = 0; i < SIZE; i++) {
+        handles.push_back(*fifo.push(i));
+    }
+    for (size_t i = 0; i < 100; i++) {
+        CHECK(fifo.cancel(handles[i]));
+    }
+    CHECK(fifo.cancel(handles[120]));
+    CHECK(fifo.getCount() == 49);
+
+    CHECK(fifo.pull(buffer.data(), SIZE) == 49);
+    CHECK(buffer[0] == 100);
+    CHECK(buffer[19] == 119);
+    CHECK(buffer[20] == 121);
+    CHECK(buffer[48] == 149);
+    CHECK(fifo.getOccupancy() == 0);
+}
+
+TEST_CASE("test_cancellable_fifo_releases_cancelled") {
+    CancellableFifo<std::shared_ptr<int>, 2> fifo{};
+    auto shared = std::make_shared<int>(0);
+
+    auto handle = fifo.push(shared);
+    CHECK(shared.use_count() == 2);
+    CHECK(fifo.cancel(*handle));
+    CHECK(shared.use_count() == 1);
+}
@@ -0,0 +1,98 @@
+/**
+ * @file tests_delta_fifo.cpp
+ * @author aurelien.dhiver@outlook.fr
+ * 
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "../DeltaFifo.hpp"
+
+#include "doctest.h"
+
+#include <limits>
+#include <vector>
+
+TEST_CASE("test_delta_fifo_compression") {
+    DeltaFifo<int64_t, 64> fifo{};
+    std::vector<int64_t> timestamps(40);
+    int64_t value;
+
+    for (size_t i = 0; i < timestamps.size(); i++) {
+        timestamps[i] = 1'700'000'000 + static_cast<int64_t>(i * 10) - static_cast<int64_t>(i % 3);
+    }
+
+    CHECK(fifo.push(timestamps) == timestamps.size());
+    CHECK_MESSAGE(fifo.getUsedBytes() == 5 + 39, "Only the first element is not a small delta");
+    CHECK(fifo.getCount() == 40);
+    CHECK_MESSAGE(fifo.push(timestamps) == 0, "Not enough space, nothing written");
+
+    std::vector<int64_t> out(64);
+    CHECK(fifo.pull(out.data(), 3) == 3);
+    CHECK(fifo.pull(out.data() + 3, out.size()) == 37);
+    out.resize(40);
+    CHECK(out == timestamps);
+    CHECK(fifo.getUsedBytes() == 0);
+    CHECK_FALSE(fifo.pop(&value));
+
+    CHECK(fifo.push(std::numeric_limits<int64_t>::min()));
+    CHECK(fifo.push(std::numeric_limits<int64_t>::max()));
+    CHECK(fifo.push(int64_t{-1}));
+    CHECK(fifo.pop(&value));
+    CHECK(value == std::numeric_limits<int64_t>::min());
+    CHECK(fifo.pop(&value));
+    CHECK(value == std::numeric_limits<int64_t>::max());
+    CHECK(fifo.pop(&value));
+    CHECK(value == -1);
+
+    fifo.reset();
+    CHECK(fifo.getCount() == 0);
+    CHECK(fifo.getFreeSpace() == 64);
+}
+
+TEST_CASE("test_delta_fifo_wrap") {
+    DeltaFifo<uint32_t, 16> fifo{};
+    std::array<uint32_t, 10> out{};
+
+    // Single-byte deltas: one run of 8 decoded at once, then 2 one by one
+    const std::array<uint32_t, 10> small{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    CHECK(fifo.push(small) == 10);
+    CHECK(fifo.getUsedBytes() == 10);
+    CHECK(fifo.pull(out.data(), out.size()) == 10);
+    CHECK(out == small);
+
+    // 2, 5 and 5-byte varints from byte 10: the second one crosses the end of the ring.
+    // Differences are modulo 2^32: going from 0xFFFFFFFF back to 0 is a large negative one.
+    const std::array<uint32_t, 3> large{310, 0xFFFFFFFFU, 0};
+    CHECK(fifo.push(large) == 3);
+    CHECK(fifo.getUsedBytes() == 12);
+    CHECK(fifo.push(small) == 0);
+    CHECK(fifo.pull(out.data(), out.size()) == 3);
+    CHECK(std::equal(large.begin(), large.end(), out.begin()));
+
+    // A multi-byte delta inside a run of 8 bytes falls back to decoding one by one
+    const std::array<uint32_t, 9> mixed{1, 2, 3, 4, 200, 201, 202, 203, 204};
+    CHECK(fifo.push(mixed) == 9);
+    CHECK(fifo.getUsedBytes() == 10);
+    CHECK(fifo.pull(out.data(), out.size()) == 9);
+    CHECK(std::equal(mixed.begin(), mixed.end(), out.begin()));
+    CHECK(fifo.getCount() == 0);
+}
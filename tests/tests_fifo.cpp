@@ -29,6 +29,12 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
 
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
 
 TEST_CASE("test_fifo_initial_state") {
     static constexpr auto FIFO_SIZE{5U};
@@ -256,3 +262,635 @@ TEST_CASE("test_read") {
     std::array<int, 10> result = {0, 1, 2, 3};
     CHECK(buffer == result);
 }
+
+TEST_CASE("test_sequence_numbers") {
+    Fifo<int, 4> fifo{};
+    CHECK(fifo.getFirstSequence() == 0);
+    CHECK(fifo.getNextSequence() == 0);
+
+    fifo.push({1, 2, 3});
+    CHECK(fifo.getFirstSequence() == 0);
+    CHECK(fifo.getNextSequence() == 3);
+
+    fifo.push({4, 5, 6}, true);
+    CHECK(fifo.getFirstSequence() == 2);
+    CHECK(fifo.getNextSequence() == 6);
+
+    fifo.drop(1);
+    CHECK(fifo.getFirstSequence() == 3);
+
+    fifo.reset();
+    CHECK(fifo.getFirstSequence() == 6);
+    CHECK(fifo.getNextSequence() == 6);
+}
+
+TEST_CASE("test_reader_replay") {
+    Fifo<int, 4> fifo{};
+    std::array<int, 4> buffer{};
+
+    fifo.push({0, 1, 2});
+    Fifo<int, 4>::Reader reader(fifo, 1);
+    CHECK(reader.getSequence() == 1);
+
+    CHECK(reader.read(buffer.data(), 4) == 2);
+    CHECK(buffer[0] == 1);
+    CHECK(buffer[1] == 2);
+    CHECK(reader.getSequence() == 3);
+    CHECK_MESSAGE(fifo.getCount() == 3, "Reading does not consume");
+    CHECK(reader.read(buffer.data(), 4) == 0);
+
+    fifo.push({3, 4, 5, 6, 7}, true);
+    CHECK(reader.read(buffer.data(), 1) == 1);
+    CHECK_MESSAGE(buffer[0] == 4, "Elements 3 was overwritten");
+    CHECK(reader.getMissed() == 1);
+
+    CHECK(reader.seek(5) == 0);
+    CHECK(reader.read(buffer.data(), 4) == 3);
+    CHECK(buffer[0] == 5);
+    CHECK(buffer[2] == 7);
+
+    CHECK(reader.seek(0) == 4);
+    CHECK(reader.getSequence() == 4);
+    CHECK(reader.getMissed() == 5);
+}
+
+TEST_CASE("test_reader_pop_back") {
+    Fifo<int, 4> fifo{};
+    std::array<int, 4> buffer{};
+    int value;
+
+    fifo.push({0, 1, 2});
+    Fifo<int, 4>::Reader reader(fifo, 0);
+    CHECK(reader.read(buffer.data(), 4) == 3);
+    CHECK(reader.getSequence() == 3);
+
+    CHECK(fifo.pop_back(&value));
+    CHECK(fifo.push(42));
+    CHECK_MESSAGE(fifo.getNextSequence() == 3, "The withdrawn sequence number is reused");
+
+    CHECK(reader.read(buffer.data(), 4) == 1);
+    CHECK_MESSAGE(buffer[0] == 42, "The element reusing a read sequence number is delivered");
+    CHECK(reader.getRetracted() == 1);
+    CHECK(reader.getMissed() == 0);
+    CHECK(reader.read(buffer.data(), 4) == 0);
+
+    // Elements not read yet are not retracted
+    CHECK(fifo.push(3));
+    CHECK(fifo.drop_back(1) == 1);
+    CHECK(fifo.push(4));
+    CHECK(reader.read(buffer.data(), 4) == 1);
+    CHECK(buffer[0] == 4);
+    CHECK(reader.getRetracted() == 1);
+
+    // Several rewinds between two reads: never skipped, possibly read again
+    CHECK(fifo.pop_back(&value));
+    CHECK(fifo.push(5));
+    CHECK(fifo.pop_back(&value));
+    CHECK(fifo.push(6));
+    CHECK(reader.read(buffer.data(), 4) == 2);
+    CHECK(buffer[0] == 42);
+    CHECK(buffer[1] == 6);
+    CHECK(reader.getRetracted() == 3);
+}
+
+TEST_CASE("test_reader_push_front") {
+    Fifo<int, 8> fifo{};
+    std::array<int, 8> buffer{};
+
+    fifo.push({10, 11, 12});
+    Fifo<int, 8>::Reader reader(fifo, 0);
+    Fifo<int, 8>::Reader late(fifo, 1);
+    CHECK(reader.read(buffer.data(), 8) == 3);
+
+    // No room below the first sequence number: the queued elements are renumbered
+    CHECK(fifo.push_front({7, 8}) == 2);
+    CHECK(fifo.push(13));
+    CHECK(fifo.getFirstSequence() == 0);
+    CHECK(fifo.getNextSequence() == 6);
+
+    CHECK(reader.read(buffer.data(), 8) == 1);
+    CHECK_MESSAGE(buffer[0] == 13, "Elements already read are not delivered again");
+    CHECK(reader.getSequence() == 6);
+    CHECK(reader.getRetracted() == 0);
+    CHECK(reader.getMissed() == 0);
+
+    CHECK(fifo.push_front(6));
+    CHECK(late.read(buffer.data(), 8) == 3);
+    CHECK_MESSAGE(buffer[0] == 11, "A reader keeps its position in the elements");
+    CHECK(buffer[2] == 13);
+
+    CHECK(late.seek(0) == 0);
+    CHECK(late.read(buffer.data(), 8) == 7);
+    CHECK(buffer[0] == 6);
+}
+
+TEST_CASE("test_remove_if") {
+    Fifo<int, 6> fifo = {0, 0, 0};
+    fifo.drop(3);
+    fifo.push({1, 2, 3, 4, 5, 6});
+
+    auto removed = fifo.remove_if([](int value) { return (value % 2) == 0; });
+    CHECK(removed == 3);
+    CHECK(fifo.getCount() == 3);
+    Fifo<int, 6> expected = {1, 3, 5};
+    CHECK(fifo == expected);
+
+    CHECK_MESSAGE(fifo.push({7, 8, 9}) == 3, "Freed slots can be written again");
+    expected = {1, 3, 5, 7, 8, 9};
+    CHECK(fifo == expected);
+
+    CHECK(fifo.remove_if([](int) { return false; }) == 0);
+    CHECK(fifo == expected);
+
+    CHECK(fifo.remove_if([](int value) { return value > 4; }) == 4);
+    expected = {1, 3};
+    CHECK(fifo == expected);
+
+    CHECK(fifo.remove_if([](int) { return true; }) == 2);
+    CHECK(fifo.getCount() == 0);
+}
+
+TEST_CASE("test_push_front") {
+    Fifo<int, 6> fifo = {0, 0};
+    fifo.drop(2);
+    fifo.push({3, 4});
+
+    CHECK(fifo.push_front(2));
+    CHECK(fifo.push_front({0, 1}) == 2);
+    Fifo<int, 6> expected = {0, 1, 2, 3, 4};
+    CHECK(fifo == expected);
+
+    CHECK_MESSAGE(fifo.push_front({-2, -1}) == 0, "Not enough space, FIFO left as is");
+    CHECK(fifo == expected);
+    CHECK(fifo.push_front(-1));
+    CHECK_FALSE(fifo.push_front(-2));
+
+    std::array<int, 6> buffer{};
+    CHECK(fifo.pull(buffer.data(), 6) == 6);
+    CHECK(buffer == std::array<int, 6>{-1, 0, 1, 2, 3, 4});
+}
+
+TEST_CASE("test_pop_back_and_drop_back") {
+    Fifo<int, 4> fifo = {0, 0, 0};
+    fifo.drop(3);
+    fifo.push({1, 2, 3, 4});
+    const auto nextSeq = fifo.getNextSequence();
+    int value;
+
+    CHECK(fifo.pop_back(&value));
+    CHECK(value == 4);
+    CHECK(fifo.getNextSequence() == nextSeq - 1);
+
+    CHECK(fifo.drop_back(1) == 1);
+    Fifo<int, 4> expected = {1, 2};
+    CHECK(fifo == expected);
+    CHECK(fifo.getFirstSequence() == nextSeq - 4);
+
+    CHECK(fifo.push(5));
+    expected = {1, 2, 5};
+    CHECK(fifo == expected);
+
+    CHECK(fifo.drop_back(10) == 3);
+    CHECK_FALSE(fifo.pop_back(&value));
+}
+
+TEST_CASE("test_push_bulk_overwrite_wraps") {
+    Fifo<int, 4> fifo = {0, 1, 2};
+    std::array<int, 6> values = {3, 4, 5, 6, 7, 8};
+
+    CHECK_MESSAGE(fifo.push(values, true) == 1, "Only one free slot before overwriting");
+    Fifo<int, 4> expected = {5, 6, 7, 8};
+    CHECK(fifo == expected);
+    CHECK(fifo.getFirstSequence() == 5);
+}
+
+TEST_CASE("test_linearize") {
+    Fifo<int, 5> fifo = {0, 0, 0};
+    fifo.drop(3);
+    fifo.push({1, 2, 3, 4});
+
+    auto contents = fifo.linearize();
+    CHECK(contents.size() == 4);
+    CHECK(std::equal(contents.begin(), contents.end(), std::array<int, 4>{1, 2, 3, 4}.begin()));
+
+    CHECK(fifo.push(5));
+    Fifo<int, 5> expected = {1, 2, 3, 4, 5};
+    CHECK(fifo == expected);
+    CHECK(fifo.linearize().size() == 5);
+
+    fifo.drop(2);
+    contents = fifo.linearize();
+    CHECK_MESSAGE(contents.size() == 3, "Contents that do not wrap are moved to the front");
+    CHECK(contents[0] == 3);
+    CHECK(contents[2] == 5);
+    CHECK(fifo.push({6, 7}) == 2);
+    expected = {3, 4, 5, 6, 7};
+    CHECK(fifo == expected);
+
+    fifo.reset();
+    CHECK(fifo.linearize().empty());
+}
+
+TEST_CASE("test_linearize_after_copy") {
+    Fifo<std::string, 5> source = {"a", "b", "c"};
+    source.drop(1);
+
+    // The copy only holds the live elements, its free slots are never read
+    Fifo<std::string, 5> fifo(source);
+    CHECK(fifo.push({"d", "e", "f"}) == 3);
+    CHECK(fifo.drop(2) == 2);
+    CHECK(fifo.push("g"));
+
+    auto contents = fifo.linearize();
+    CHECK(contents.size() == 4);
+    CHECK(contents[0] == "d");
+    CHECK(contents[3] == "g");
+
+    Fifo<int, 4> full = {1, 2, 3, 4};
+    full.drop(1);
+    full.push(5);
+    Fifo<int, 4> copy(full);
+    copy.drop(2);
+    CHECK(copy.push({6, 7}) == 2);
+    const auto all = copy.linearize();
+    CHECK_MESSAGE(std::equal(all.begin(), all.end(), std::array<int, 4>{4, 5, 6, 7}.begin()),
+                  "Full and wrapped contents are rotated");
+}
+
+TEST_CASE("test_read_at_offset") {
+    Fifo<int, 5> fifo = {0, 0, 0};
+    fifo.drop(3);
+    fifo.push({1, 2, 3, 4, 5});
+    std::array<int, 5> buffer{};
+
+    CHECK(fifo.read(buffer.data(), 2, 1) == 2);
+    CHECK(buffer[0] == 2);
+    CHECK(buffer[1] == 3);
+
+    CHECK_MESSAGE(fifo.read(buffer.data(), 5, 2) == 3, "Read across the end of the container");
+    CHECK(buffer[0] == 3);
+    CHECK(buffer[2] == 5);
+
+    CHECK(fifo.read(buffer.data(), 5, 5) == 0);
+    CHECK(fifo.read(buffer.data(), 5, 10) == 0);
+    CHECK(fifo.getCount() == 5);
+}
+
+TEST_CASE("test_peek_span") {
+    Fifo<int, 5> fifo = {0, 0, 0};
+    fifo.drop(3);
+    fifo.push({1, 2, 3, 4});
+
+    auto [first, second] = fifo.peek_span(0, 4);
+    CHECK(first.size() == 2);
+    CHECK(second.size() == 2);
+    CHECK(first[0] == 1);
+    CHECK(second[1] == 4);
+
+    auto [header, empty] = fifo.peek_span(2, 1);
+    CHECK(header.size() == 1);
+    CHECK(header[0] == 3);
+    CHECK(empty.empty());
+
+    const auto &constFifo = fifo;
+    auto [tail, none] = constFifo.peek_span(3, 10);
+    CHECK(tail.size() == 1);
+    CHECK(tail[0] == 4);
+    CHECK(none.empty());
+
+    fifo.peek_span(1, 1).first[0] = 20;
+    CHECK(fifo[1] == 20);
+}
+
+TEST_CASE("test_scatter_gather") {
+    Fifo<int, 6> fifo = {0, 0, 0, 0};
+    fifo.drop(4);
+
+    std::array<int, 1> header = {1};
+    std::array<int, 3> body = {2, 3, 4};
+    std::array<int, 1> trailer = {5};
+    std::array<std::span<const int>, 3> message = {header, body, trailer};
+
+    CHECK(fifo.push(message) == 5);
+    CHECK_MESSAGE(fifo.push(message) == 0, "All or nothing");
+    Fifo<int, 6> expected = {1, 2, 3, 4, 5};
+    CHECK(fifo == expected);
+
+    std::array<int, 2> first{};
+    std::array<int, 0> none{};
+    std::array<int, 4> second{};
+    std::array<std::span<int>, 3> dests = {first, none, second};
+
+    CHECK(fifo.pull(dests) == 5);
+    CHECK(first == std::array<int, 2>{1, 2});
+    CHECK(second == std::array<int, 4>{3, 4, 5, 0});
+    CHECK(fifo.getCount() == 0);
+    CHECK(fifo.getNextSequence() == 9);
+
+    fifo.push({6, 7, 8});
+    std::array<std::span<int>, 1> single = {first};
+    CHECK(fifo.pull(single) == 2);
+    CHECK(first == std::array<int, 2>{6, 7});
+    CHECK(fifo.getCount() == 1);
+}
+
+TEST_CASE("test_push_range") {
+    Fifo<int, 5> fifo{};
+    std::vector<int> contiguous = {1, 2};
+    std::list<int> sized = {3, 4};
+
+    CHECK(fifo.push_range(contiguous) == 2);
+    CHECK(fifo.push_range(sized) == 2);
+    CHECK_MESSAGE(fifo.push_range(sized) == 0, "Sized ranges are pushed only if they fit");
+
+    auto generated = std::views::iota(5, 10) | std::views::filter([](int value) { return value > 0; });
+    CHECK_MESSAGE(fifo.push_range(generated) == 1, "Unsized ranges are pushed until the FIFO is full");
+    Fifo<int, 5> expected = {1, 2, 3, 4, 5};
+    CHECK(fifo == expected);
+
+    CHECK(fifo.push_range(std::views::iota(6, 8), true) == 0);
+    expected = {3, 4, 5, 6, 7};
+    CHECK(fifo == expected);
+}
+
+TEST_CASE("test_back_inserter") {
+    Fifo<char, 8> fifo{};
+    std::string_view text = "hello";
+
+    std::ranges::copy(text, fifo.back_inserter());
+    CHECK(fifo.getCount() == 5);
+
+    std::ranges::copy(std::string_view(" world"), fifo.back_inserter());
+    CHECK(fifo.getCount() == 8);
+
+    std::array<char, 8> buffer{};
+    CHECK(fifo.read(buffer.data(), buffer.size()) == 8);
+    CHECK(std::string_view(buffer.data(), buffer.size()) == "hello wo");
+
+    std::ranges::copy(std::string_view("rld"), fifo.back_inserter(true));
+    CHECK(fifo.read(buffer.data(), buffer.size()) == 8);
+    CHECK(std::string_view(buffer.data(), buffer.size()) == "lo world");
+}
+
+TEST_CASE("test_consume") {
+    Fifo<int, 5> fifo = {0, 0, 0};
+    fifo.drop(3);
+    fifo.push({1, 2, 3, 4, 5});
+    int sum = 0;
+
+    CHECK(fifo.consume(2, [&sum](int &value) { sum += value; }) == 2);
+    CHECK(sum == 3);
+    CHECK(fifo.getCount() == 3);
+
+    std::vector<size_t> segments;
+    CHECK(fifo.consume_all([&](std::span<int> segment) {
+        segments.push_back(segment.size());
+        for (int value : segment) {
+            sum += value;
+        }
+    }) == 3);
+    CHECK(segments == std::vector<size_t>{3});
+    CHECK(sum == 15);
+    CHECK(fifo.getCount() == 0);
+
+    fifo.push({6, 7, 8, 9});
+    segments.clear();
+    CHECK(fifo.consume(10, [&](std::span<int> segment) { segments.push_back(segment.size()); }) == 4);
+    CHECK(segments == std::vector<size_t>{2, 2});
+    CHECK(fifo.consume_all([](int &) {}) == 0);
+}
+
+TEST_CASE("test_move_only_elements") {
+    using Ptr = std::unique_ptr<int>;
+    Fifo<Ptr, 4> fifo{};
+    static_assert(noexcept(fifo.pull(nullptr, 0)));
+    static_assert(noexcept(fifo.push_move(std::span<Ptr>{})));
+
+    std::array<Ptr, 3> src = {std::make_unique<int>(1), std::make_unique<int>(2), std::make_unique<int>(3)};
+    CHECK(fifo.push(std::make_unique<int>(0)));
+    CHECK(fifo.push_move(src) == 3);
+    CHECK(src[0] == nullptr);
+    CHECK_MESSAGE(fifo.push_move(src) == 0, "Not enough space");
+
+    std::array<Ptr, 3> dest{};
+    CHECK(fifo.pull(dest.data(), 2) == 2);
+    CHECK(*dest[0] == 0);
+    CHECK(*dest[1] == 1);
+
+    src[0] = std::make_unique<int>(4);
+    src[1] = std::make_unique<int>(5);
+    CHECK(fifo.push_move(std::span<Ptr>{src}.first(2)) == 2);
+
+    std::array<std::span<Ptr>, 2> dests = {std::span<Ptr>{dest}.first(1), std::span<Ptr>{dest}.last(2)};
+    CHECK(fifo.pull(dests) == 3);
+    CHECK(*dest[0] == 2);
+    CHECK(*dest[1] == 3);
+    CHECK(*dest[2] == 4);
+    CHECK(fifo.getCount() == 1);
+}
+
+TEST_CASE("test_removed_elements_are_released") {
+    auto shared = std::make_shared<int>(0);
+    Fifo<std::shared_ptr<int>, 4> fifo{};
+
+    fifo.push({shared, shared, shared, shared});
+    CHECK(shared.use_count() == 5);
+
+    fifo.drop(1);
+    CHECK(shared.use_count() == 4);
+    fifo.drop_back(1);
+    CHECK(shared.use_count() == 3);
+
+    std::shared_ptr<int> value;
+    fifo.pop(&value);
+    CHECK(shared.use_count() == 3);
+    value.reset();
+    CHECK(shared.use_count() == 2);
+
+    fifo.reset();
+    CHECK(shared.use_count() == 1);
+}
+
+TEST_CASE("test_copy_and_move") {
+    Fifo<int, 5> fifo = {0, 0, 0};
+    fifo.drop(3);
+    fifo.push({1, 2, 3, 4});
+
+    auto copy = fifo;
+    CHECK(copy == fifo);
+    CHECK(copy.getFirstSequence() == fifo.getFirstSequence());
+    auto [first, second] = copy.peek_span(0, 4);
+    CHECK_MESSAGE(second.empty(), "Copies are linearized");
+
+    Fifo<int, 5> assigned = {7};
+    assigned = fifo;
+    CHECK(assigned == fifo);
+
+    auto moved = std::move(copy);
+    CHECK(moved == fifo);
+    CHECK(copy.getCount() == 0);
+
+    assigned = std::move(moved);
+    CHECK(assigned == fifo);
+    CHECK(moved.getCount() == 0);
+
+    static_assert(!std::is_copy_constructible_v<Fifo<std::unique_ptr<int>, 2>>);
+    static_assert(std::is_nothrow_move_constructible_v<Fifo<std::unique_ptr<int>, 2>>);
+}
+
+TEST_CASE("test_convert_capacity") {
+    Fifo<int, 5> fifo = {0, 0, 0};
+    fifo.drop(3);
+    fifo.push({1, 2, 3, 4});
+
+    Fifo<int, 8> larger(fifo);
+    Fifo<int, 8> expectedLarger = {1, 2, 3, 4};
+    CHECK(larger == expectedLarger);
+    CHECK(larger.getNextSequence() == fifo.getNextSequence());
+
+    Fifo<int, 2> smaller(fifo);
+    Fifo<int, 2> expectedSmaller = {3, 4};
+    CHECK_MESSAGE(smaller == expectedSmaller, "Only the last elements are kept");
+    CHECK(smaller.getFirstSequence() == fifo.getFirstSequence() + 2);
+
+    Fifo<std::unique_ptr<int>, 3> owning{};
+    owning.push(std::make_unique<int>(1));
+    Fifo<std::unique_ptr<int>, 6> movedTo(std::move(owning));
+    CHECK(movedTo.getCount() == 1);
+    CHECK(*movedTo[0] == 1);
+    CHECK(owning.getCount() == 0);
+}
+
+TEST_CASE("test_snapshot_restore") {
+    Fifo<int, 5> fifo = {0, 0, 0};
+    fifo.drop(3);
+    fifo.push({1, 2, 3, 4});
+    std::array<std::byte, Fifo<int, 5>::s_maxSnapshotSize> image{};
+
+    const auto size = fifo.snapshot(image);
+    CHECK(size == sizeof(Fifo<int, 5>::SnapshotHeader) + 4 * sizeof(int));
+    CHECK_MESSAGE(fifo.snapshot(std::span<std::byte>{image}.first(size - 1)) == 0, "Buffer too small");
+
+    Fifo<int, 5> restored = {9, 9};
+    CHECK(restored.restore(std::span<const std::byte>{image}.first(size)));
+    CHECK(restored == fifo);
+    CHECK(restored.getFirstSequence() == fifo.getFirstSequence());
+    CHECK(restored.getNextSequence() == fifo.getNextSequence());
+
+    CHECK_FALSE(restored.restore(std::span<const std::byte>{image}.first(size - 1)));
+    image[0] = std::byte{0};
+    CHECK_FALSE_MESSAGE(restored.restore(image), "Invalid magic");
+    CHECK(restored == fifo);
+}
+
+TEST_CASE("test_snapshot_delta") {
+    Fifo<int, 5> fifo = {1, 2, 3};
+    std::array<std::byte, Fifo<int, 5>::s_maxSnapshotSize> image{};
+
+    fifo.snapshot(image);
+    Fifo<int, 5> restored{};
+    CHECK(restored.restore(image));
+
+    auto checkpoint = fifo.getNextSequence();
+    fifo.drop(2);
+    fifo.push({4, 5, 6});
+    const auto size = fifo.snapshot(image, checkpoint);
+    CHECK_MESSAGE(size == sizeof(Fifo<int, 5>::SnapshotHeader) + 3 * sizeof(int), "Only new elements");
+
+    CHECK(restored.restore(std::span<const std::byte>{image}.first(size)));
+    CHECK(restored == fifo);
+    CHECK(restored.getFirstSequence() == fifo.getFirstSequence());
+    CHECK_FALSE_MESSAGE(restored.restore(std::span<const std::byte>{image}.first(size)),
+                        "Delta already applied");
+
+    checkpoint = fifo.getNextSequence();
+    fifo.push({7, 8}, true);
+    int value;
+    fifo.pop(&value);
+    CHECK(restored.restore(std::span<const std::byte>{image}.first(fifo.snapshot(image, checkpoint))));
+    CHECK(restored == fifo);
+}
+
+TEST_CASE("test_snapshot_delta_after_target_drop") {
+    Fifo<int, 8> fifo = {1, 2, 3, 4};
+    std::array<std::byte, Fifo<int, 8>::s_maxSnapshotSize> image{};
+
+    fifo.snapshot(image);
+    Fifo<int, 8> restored{};
+    CHECK(restored.restore(image));
+    CHECK(restored.drop(3) == 3);
+
+    const auto checkpoint = fifo.getNextSequence();
+    fifo.push({5, 6});
+    const auto size = fifo.snapshot(image, checkpoint);
+    CHECK_FALSE_MESSAGE(restored.restore(std::span<const std::byte>{image}.first(size)),
+                        "Elements of the image head were dropped from the target");
+    CHECK(restored.getCount() == 1);
+    CHECK(restored.getNextSequence() == checkpoint);
+}
+
+TEST_CASE("test_fixed_size_blocks") {
+    Fifo<int, 5> fifo{};
+    std::array<int, 3> block = {1, 2, 3};
+    std::array<int, 3> out{};
+
+    CHECK(fifo.push(block) == 3);
+    CHECK_MESSAGE(fifo.push(block) == 0, "Not enough space for the whole block");
+    CHECK(fifo.pull(out) == 3);
+    CHECK(out == block);
+    CHECK_MESSAGE(fifo.pull(out) == 0, "Less than a whole block");
+
+    block = {4, 5, 6};
+    CHECK_MESSAGE(fifo.push(block) == 3, "Block wrapping around the end of the container");
+    const std::array<const int, 2> constBlock = {7, 8};
+    CHECK(fifo.push(constBlock) == 2);
+    Fifo<int, 5> expected = {4, 5, 6, 7, 8};
+    CHECK(fifo == expected);
+    CHECK(fifo.getNextSequence() == 8);
+
+    CHECK(fifo.pull(out) == 3);
+    CHECK(out == std::array<int, 3>{4, 5, 6});
+
+    CHECK(fifo.push(block, true) == 3);
+    expected = {7, 8, 4, 5, 6};
+    CHECK(fifo == expected);
+    CHECK(fifo.push(block, true) == 0);
+    expected = {5, 6, 4, 5, 6};
+    CHECK(fifo == expected);
+}
+
+TEST_CASE("test_byte_order_conversion") {
+    Fifo<uint32_t, 5> fifo{};
+    std::array<uint32_t, 5> out{};
+    const std::array<uint32_t, 3> network{0x11223344U, 0xAABBCCDDU, 0x00000001U};
+
+    CHECK(fifo.push(uint32_t{0}));
+    CHECK(fifo.push(uint32_t{0}));
+    CHECK(fifo.drop(2) == 2);
+
+    // Bytes as received from the network, most significant first
+    std::array<uint8_t, 12> wire{0x11, 0x22, 0x33, 0x44, 0xAA, 0xBB, 0xCC, 0xDD, 0x00, 0x00, 0x00, 0x01};
+    std::array<uint32_t, 3> bigEndian{};
+    std::memcpy(bigEndian.data(), wire.data(), wire.size());
+
+    CHECK(fifo.push_be(bigEndian) == 3);
+    CHECK(fifo.push_le(std::array<uint32_t, 2>{0x11223344U, 0x55667788U}) == 2);
+    CHECK(fifo.push_be(bigEndian) == 0);
+    CHECK_MESSAGE(fifo[0] == network[0], "Converted to native order across the wrap");
+    CHECK(fifo[1] == network[1]);
+    CHECK(fifo[2] == network[2]);
+    if constexpr (std::endian::native == std::endian::little) {
+        CHECK(fifo[3] == 0x11223344U);
+    }
+
+    CHECK(fifo.pull_be(out.data(), 3) == 3);
+    CHECK(std::memcmp(out.data(), wire.data(), wire.size()) == 0);
+    CHECK(fifo.pull_le(out.data(), out.size()) == 2);
+    CHECK(fifo.getCount() == 0);
+
+    Fifo<int16_t, 3> shorts{};
+    CHECK(shorts.push_be(std::array<int16_t, 4>{0x0100, 0x0200, 0x0300, static_cast<int16_t>(0xFFFE)}, true) == 3);
+    std::array<int16_t, 3> converted{};
+    CHECK(shorts.pull_be(converted.data(), converted.size()) == 3);
+    CHECK(converted == std::array<int16_t, 3>{0x0200, 0x0300, static_cast<int16_t>(0xFFFE)});
+}
@@ -0,0 +1,79 @@
+/**
+ * @file tests_fifo_algorithms.cpp
+ * @author aurelien.dhiver@outlook.fr
+ * 
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "../FifoAlgorithms.hpp"
+
+#include "doctest.h"
+
+#include <vector>
+
+namespace {
+
+/// FIFO holding {1, 2, 3, 4, 5}, wrapping around the end of its container
+Fifo<int, 6> makeWrappedFifo() {
+    Fifo<int, 6> fifo = {0, 0, 0, 0};
+    fifo.drop(4);
+    fifo.push({1, 2, 3, 4, 5});
+    return fifo;
+}
+
+} // namespace
+
+TEST_CASE("test_for_each_segment") {
+    auto fifo = makeWrappedFifo();
+    std::vector<size_t> sizes;
+
+    fifo_algorithms::for_each_segment(fifo, [&](std::span<int> segment) { sizes.push_back(segment.size()); });
+    CHECK(sizes == std::vector<size_t>{2, 3});
+
+    Fifo<int, 6> empty{};
+    sizes.clear();
+    fifo_algorithms::for_each_segment(empty, [&](std::span<int> segment) { sizes.push_back(segment.size()); });
+    CHECK(sizes.empty());
+}
+
+TEST_CASE("test_fifo_reductions") {
+    const auto fifo = makeWrappedFifo();
+
+    CHECK(fifo_algorithms::accumulate(fifo, 0) == 15);
+    CHECK(fifo_algorithms::accumulate(fifo, 0, [](int acc, int value) { return acc * 10 + value; }) == 12345);
+    CHECK(fifo_algorithms::reduce(fifo, 0) == 15);
+    CHECK(fifo_algorithms::reduce(fifo, 0, [](int a, int b) { return std::max(a, b); }) == 5);
+    CHECK(fifo_algorithms::count(fifo, 3) == 1);
+    CHECK(fifo_algorithms::count_if(fifo, [](int value) { return value % 2 == 1; }) == 3);
+}
+
+TEST_CASE("test_fifo_transform") {
+    auto fifo = makeWrappedFifo();
+    std::vector<int> squares;
+
+    fifo_algorithms::transform(fifo, std::back_inserter(squares), [](int value) { return value * value; });
+    CHECK(squares == std::vector<int>{1, 4, 9, 16, 25});
+
+    fifo_algorithms::transform(fifo, [](int value) { return -value; });
+    Fifo<int, 6> expected = {-1, -2, -3, -4, -5};
+    CHECK(fifo == expected);
+}
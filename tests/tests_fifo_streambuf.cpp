@@ -0,0 +1,93 @@
+/**
+ * @file tests_fifo_streambuf.cpp
+ * @author aurelien.dhiver@outlook.fr
+ * 
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "../FifoStreambuf.hpp"
+
+#include "doctest.h"
+
+#include <istream>
+#include <ostream>
+#include <string>
+
+TEST_CASE("test_write_span_and_commit") {
+    Fifo<int, 4> fifo = {0, 0, 0};
+    fifo.drop(2);
+
+    auto [first, second] = fifo.write_span(10);
+    CHECK(first.size() == 1);
+    CHECK(second.size() == 2);
+    first[0] = 1;
+    second[0] = 2;
+    CHECK(fifo.getCount() == 1);
+
+    CHECK(fifo.commit(2) == 2);
+    Fifo<int, 4> expected = {0, 1, 2};
+    CHECK(fifo == expected);
+    CHECK(fifo.commit(5) == 1);
+    CHECK(fifo.write_span(1).first.empty());
+}
+
+TEST_CASE("test_fifo_streambuf_write_then_read") {
+    Fifo<char, 16> fifo{};
+    FifoStreambuf buf(fifo);
+    std::ostream os(&buf);
+    std::istream is(&buf);
+
+    os << "value " << 42 << ' ';
+    os.flush();
+    CHECK(fifo.getCount() == 9);
+
+    std::string word;
+    int number = 0;
+    is >> word >> number;
+    CHECK(word == "value");
+    CHECK(number == 42);
+
+    // the next writes wrap around the end of the container
+    os << "wrapped text";
+    std::string first;
+    std::string second;
+    is >> first >> second;
+    CHECK(first == "wrapped");
+    CHECK(second == "text");
+    CHECK(is.eof());
+}
+
+TEST_CASE("test_fifo_streambuf_full") {
+    Fifo<char, 4> fifo{};
+    {
+        FifoStreambuf buf(fifo);
+        std::ostream os(&buf);
+
+        os << "abcdef";
+        CHECK_FALSE_MESSAGE(os.good(), "Writing to a full FIFO fails");
+    }
+    CHECK(fifo.getCount() == 4);
+
+    std::array<char, 4> buffer{};
+    fifo.pull(buffer.data(), buffer.size());
+    CHECK(std::string(buffer.data(), buffer.size()) == "abcd");
+}
@@ -0,0 +1,91 @@
+/**
+ * @file tests_frame_fifo.cpp
+ * @author aurelien.dhiver@outlook.fr
+ * 
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "../FrameFifo.hpp"
+
+#include "doctest.h"
+
+#include <numeric>
+
+TEST_CASE("test_frame_fifo_in_place") {
+    FrameFifo<int, 4, 3> fifo{};
+
+    for (int i = 0; i < 3; i++) {
+        auto slot = fifo.write_frame();
+        REQUIRE(slot.has_value());
+        std::iota(slot->begin(), slot->end(), i * 4);
+        CHECK(fifo.commit() == 1);
+    }
+    CHECK(fifo.getCount() == 3);
+    CHECK(fifo.getFreeSpace() == 0);
+    CHECK_FALSE(fifo.write_frame().has_value());
+    CHECK(fifo.commit() == 0);
+
+    CHECK(fifo[1][0] == 4);
+    CHECK(fifo[2][3] == 11);
+
+    auto frame = fifo.read_frame();
+    REQUIRE(frame.has_value());
+    CHECK(std::accumulate(frame->begin(), frame->end(), 0) == 0 + 1 + 2 + 3);
+    CHECK(fifo.release() == 1);
+
+    // The next frame written reuses the first slot, it never straddles the wrap
+    auto slot = fifo.write_frame();
+    REQUIRE(slot.has_value());
+    CHECK(slot->data() == frame->data());
+    std::fill(slot->begin(), slot->end(), 42);
+    CHECK(fifo.commit() == 1);
+
+    CHECK(fifo.release(2) == 2);
+    CHECK(fifo[0][0] == 42);
+    CHECK(fifo.release(5) == 1);
+    CHECK_FALSE(fifo.read_frame().has_value());
+}
+
+TEST_CASE("test_frame_fifo_push_pull") {
+    FrameFifo<int, 2, 2> fifo{};
+    std::array<int, 2> frame{};
+
+    CHECK_FALSE(fifo.pull(frame));
+    CHECK(fifo.push(std::array<int, 2>{1, 2}));
+    CHECK(fifo.push(std::array<int, 2>{3, 4}));
+    CHECK_FALSE(fifo.push(std::array<int, 2>{5, 6}));
+    CHECK(fifo.push(std::array<int, 2>{5, 6}, true));
+    CHECK(fifo.getCount() == 2);
+
+    CHECK(fifo.pull(frame));
+    CHECK(frame == std::array<int, 2>{3, 4});
+    CHECK(fifo.pull(frame));
+    CHECK(frame == std::array<int, 2>{5, 6});
+    CHECK(fifo.getCount() == 0);
+
+    const auto &constFifo = fifo;
+    CHECK_FALSE(constFifo.read_frame().has_value());
+    fifo.push(std::array<int, 2>{7, 8});
+    CHECK((*constFifo.read_frame())[1] == 8);
+    fifo.reset();
+    CHECK(fifo.getCount() == 0);
+}
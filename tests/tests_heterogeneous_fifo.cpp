@@ -0,0 +1,163 @@
+/**
+ * @file tests_heterogeneous_fifo.cpp
+ * @author aurelien.dhiver@outlook.fr
+ * 
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "../HeterogeneousFifo.hpp"
+
+#include "doctest.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Small {
+    uint8_t value;
+};
+
+struct Large {
+    std::array<uint64_t, 6> values;
+};
+
+struct Owning {
+    std::shared_ptr<int> ptr;
+};
+
+template <class... Ts>
+struct Overloaded : Ts... {
+    using Ts::operator()...;
+};
+
+using MsgFifo = HeterogeneousFifo<128, Small, Large, std::string, Owning>;
+
+} // namespace
+
+TEST_CASE("test_heterogeneous_fifo_push_and_pop") {
+    MsgFifo fifo{};
+    std::vector<std::string> visited;
+
+    auto visitor = Overloaded{
+        [&](Small &msg) { visited.push_back("small " + std::to_string(msg.value)); },
+        [&](Large &msg) { visited.push_back("large " + std::to_string(msg.values[5])); },
+        [&](std::string &msg) { visited.push_back(std::move(msg)); },
+        [&](Owning &) { visited.push_back("owning"); },
+    };
+
+    CHECK(fifo.push(Small{7}));
+    CHECK(fifo.push(std::string("hello")));
+    CHECK(fifo.emplace<Large>(Large{{0, 0, 0, 0, 0, 42}}));
+    CHECK(fifo.getCount() == 3);
+    CHECK(fifo.getUsedBytes() ==
+          MsgFifo::recordSize<Small>() + MsgFifo::recordSize<std::string>() + MsgFifo::recordSize<Large>());
+
+    while (fifo.pop(visitor)) {
+    }
+
+    CHECK(visited == std::vector<std::string>{"small 7", "hello", "large 42"});
+    CHECK(fifo.getCount() == 0);
+    CHECK(fifo.getUsedBytes() == 0);
+    CHECK_FALSE(fifo.pop(visitor));
+}
+
+TEST_CASE("test_heterogeneous_fifo_full_and_wrap") {
+    HeterogeneousFifo<64, Small, Large> fifo{};
+    static_assert(decltype(fifo)::recordSize<Small>() == 16);
+    static_assert(decltype(fifo)::recordSize<Large>() == 56);
+
+    std::vector<int> visited;
+    auto visitor = Overloaded{
+        [&](Small &msg) { visited.push_back(msg.value); },
+        [&](Large &msg) { visited.push_back(static_cast<int>(msg.values[0])); },
+    };
+
+    CHECK(fifo.push(Small{1}));
+    CHECK(fifo.push(Small{2}));
+    CHECK(fifo.push(Small{3}));
+    CHECK_FALSE(fifo.push(Large{}));
+
+    CHECK(fifo.pop(visitor));
+    CHECK(fifo.pop(visitor));
+    CHECK(fifo.push(Small{4}));
+    CHECK(fifo.push(Small{5}));
+    CHECK(fifo.push(Small{6}));
+    CHECK(fifo.getUsedBytes() == 64);
+    CHECK_FALSE(fifo.push(Small{7}));
+
+    while (fifo.pop(visitor)) {
+    }
+    CHECK(fifo.getCount() == 0);
+
+    CHECK_MESSAGE(fifo.push(Large{{100, 0, 0, 0, 0, 0}}), "Empty FIFO restarts at the beginning");
+    CHECK(fifo.pop(visitor));
+
+    CHECK(visited == std::vector<int>{1, 2, 3, 4, 5, 6, 100});
+}
+
+TEST_CASE("test_heterogeneous_fifo_padding_at_end") {
+    HeterogeneousFifo<64, Small, Large> fifo{};
+    std::vector<int> visited;
+    auto visitor = Overloaded{
+        [&](Small &msg) { visited.push_back(msg.value); },
+        [&](Large &msg) { visited.push_back(static_cast<int>(msg.values[0])); },
+    };
+
+    CHECK(fifo.push(Small{1}));
+    CHECK(fifo.push(Small{2}));
+    CHECK(fifo.push(Small{3}));
+    CHECK(fifo.pop(visitor));
+    CHECK(fifo.pop(visitor));
+
+    // 16 bytes left at the end and 32 at the beginning: the second small message is skipped
+    // past the end of the ring
+    CHECK(fifo.push(Small{4}));
+    CHECK(fifo.push(Small{5}));
+    CHECK(fifo.getUsedBytes() == 48);
+
+    CHECK(fifo.pop(visitor));
+    CHECK(fifo.pop(visitor));
+    CHECK(fifo.pop(visitor));
+    CHECK(visited == std::vector<int>{1, 2, 3, 4, 5});
+}
+
+TEST_CASE("test_heterogeneous_fifo_destroys_messages") {
+    auto shared = std::make_shared<int>(0);
+    {
+        MsgFifo fifo{};
+        CHECK(fifo.push(Owning{shared}));
+        CHECK(fifo.push(Owning{shared}));
+        CHECK(shared.use_count() == 3);
+
+        CHECK(fifo.pop([](auto &) {}));
+        CHECK(shared.use_count() == 2);
+
+        CHECK(fifo.push(Owning{shared}));
+        fifo.reset();
+        CHECK(shared.use_count() == 1);
+
+        CHECK(fifo.push(Owning{shared}));
+    }
+    CHECK(shared.use_count() == 1);
+}
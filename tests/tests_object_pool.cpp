@@ -0,0 +1,86 @@
+/**
+ * @file tests_object_pool.cpp
+ * @author aurelien.dhiver@outlook.fr
+ * 
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "../ObjectPool.hpp"
+
+#include "doctest.h"
+
+namespace {
+
+struct Frame {
+    std::array<uint8_t, 4096> data;
+    size_t size;
+};
+
+} // namespace
+
+TEST_CASE("test_object_pool_acquire_release") {
+    ObjectPool<int, 3> pool{};
+    ObjectPool<int, 3>::Handle handles[4];
+
+    CHECK(pool.getAvailable() == 3);
+    CHECK(pool.acquire(&handles[0]));
+    CHECK(pool.acquire(&handles[1]));
+    CHECK(pool.acquire(&handles[2]));
+    CHECK_FALSE_MESSAGE(pool.acquire(&handles[3]), "Pool should be exhausted");
+    CHECK(pool.getAvailable() == 0);
+
+    CHECK(handles[0] != handles[1]);
+    CHECK(handles[1] != handles[2]);
+
+    pool[handles[1]] = 42;
+    pool.release(handles[1]);
+    CHECK(pool.getAvailable() == 1);
+
+    CHECK(pool.acquire(&handles[3]));
+    CHECK(handles[3] == handles[1]);
+    CHECK(pool[handles[3]] == 42);
+}
+
+TEST_CASE("test_pooled_fifo") {
+    static PooledFifo<Frame, 4> fifo{};
+    PooledFifo<Frame, 4>::Handle handle;
+
+    for (uint8_t i = 0; i < 4; i++) {
+        REQUIRE(fifo.acquire(&handle));
+        fifo[handle].data[0] = i;
+        fifo[handle].size = i + 1U;
+        fifo.push(handle);
+    }
+    CHECK_FALSE(fifo.acquire(&handle));
+    CHECK(fifo.getCount() == 4);
+    CHECK(fifo.getAvailable() == 0);
+
+    for (uint8_t i = 0; i < 4; i++) {
+        REQUIRE(fifo.pop(&handle));
+        CHECK(fifo[handle].data[0] == i);
+        CHECK(fifo[handle].size == i + 1U);
+        fifo.release(handle);
+    }
+    CHECK_FALSE(fifo.pop(&handle));
+    CHECK(fifo.getCount() == 0);
+    CHECK(fifo.getAvailable() == 4);
+}
@@ -0,0 +1,95 @@
+/**
+ * @file tests_packed_fifo.cpp
+ * @author aurelien.dhiver@outlook.fr
+ * 
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "../PackedFifo.hpp"
+
+#include "doctest.h"
+
+#include <algorithm>
+#include <vector>
+
+TEST_CASE("test_packed_fifo_signed_samples") {
+    PackedFifo<int16_t, 12, 10> fifo{};
+    int16_t sample;
+
+    CHECK(fifo.getStorageSize() == 15 + 8);
+    CHECK(fifo.push(int16_t{-2048}));
+    CHECK(fifo.push(int16_t{2047}));
+    CHECK(fifo.push(std::vector<int16_t>{-1, 0, 1}) == 3);
+    CHECK(fifo.getCount() == 5);
+    CHECK(fifo[0] == -2048);
+    CHECK(fifo[1] == 2047);
+    CHECK(fifo[2] == -1);
+    CHECK_MESSAGE(fifo.push(std::vector<int16_t>(6, 5)) == 0, "Not enough space, nothing written");
+
+    CHECK(fifo.pop(&sample));
+    CHECK(sample == -2048);
+    CHECK(fifo.push(int16_t{0x1801}));
+    CHECK_MESSAGE(fifo[4] == -2047, "Truncated to 12 bits then sign extended");
+
+    std::array<int16_t, 8> buffer{};
+    CHECK(fifo.pull(buffer.data(), buffer.size()) == 5);
+    CHECK(buffer == std::array<int16_t, 8>{2047, -1, 0, 1, -2047, 0, 0, 0});
+    CHECK_FALSE(fifo.pop(&sample));
+}
+
+TEST_CASE("test_packed_fifo_groups_and_wrap") {
+    // 14-bit samples: a group of 8 spans 14 bytes and its 5th sample straddles two 64-bit words.
+    // 20 slots: full groups at slots 0 and 8, slots 16 to 19 are always accessed one by one.
+    PackedFifo<uint32_t, 14, 20> fifo{};
+    const auto sample = [](size_t i) { return static_cast<uint32_t>((i * 0x2A5U + 0x3F00U) & 0x3FFFU); };
+    std::vector<uint32_t> samples(25);
+    std::vector<uint32_t> out(20);
+
+    for (size_t i = 0; i < samples.size(); i++) {
+        samples[i] = sample(i);
+    }
+    samples[4] = 0x3FFF;
+
+    CHECK(fifo.push(std::span<const uint32_t>{samples}.first(20)) == 20);
+    for (size_t i = 0; i < 20; i++) {
+        REQUIRE(fifo[i] == samples[i]);
+    }
+
+    CHECK(fifo.pull(out.data(), 5) == 5);
+    CHECK(std::equal(out.begin(), out.begin() + 5, samples.begin()));
+
+    // Written one by one across the wrap, slot 5 and its neighbours are left as is
+    CHECK(fifo.push(std::span<const uint32_t>{samples}.subspan(20)) == 5);
+    CHECK(fifo[0] == samples[5]);
+    CHECK(fifo[19] == samples[24]);
+
+    // Single samples up to slot 8, a group, the tail slots, then wrap
+    CHECK(fifo.pull(out.data(), 20) == 20);
+    CHECK(std::equal(out.begin(), out.end(), samples.begin() + 5));
+
+    // A group overwriting stale bits leaves no trace of them
+    CHECK(fifo.push(std::vector<uint32_t>(3, 0)) == 3);
+    CHECK(fifo.pull(out.data(), 3) == 3);
+    CHECK(fifo.push(std::vector<uint32_t>(8, 0)) == 8);
+    CHECK(fifo.pull(out.data(), 8) == 8);
+    CHECK(std::all_of(out.begin(), out.begin() + 8, [](uint32_t value) { return value == 0; }));
+}
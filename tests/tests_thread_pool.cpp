@@ -0,0 +1,192 @@
+/**
+ * @file tests_thread_pool.cpp
+ * @author aurelien.dhiver@outlook.fr
+ * 
+ * Copyright (c) 2025 aurelien.dhiver@outlook.fr
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ * 
+ */
+
+#include "../ThreadPool.hpp"
+
+#include "doctest.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+TEST_CASE("test_inline_task") {
+    int counter = 0;
+    InlineTask<> task([&counter] { counter++; });
+    CHECK(static_cast<bool>(task));
+
+    task();
+    CHECK(counter == 1);
+
+    InlineTask<> moved = std::move(task);
+    CHECK_FALSE(static_cast<bool>(task));
+    moved();
+    CHECK(counter == 2);
+
+    InlineTask<> empty{};
+    CHECK_FALSE(static_cast<bool>(empty));
+}
+
+TEST_CASE("test_inline_task_destroys_callable") {
+    auto shared = std::make_shared<int>(0);
+    {
+        InlineTask<> task([shared] { (*shared)++; });
+        CHECK(shared.use_count() == 2);
+
+        InlineTask<> other{};
+        other = std::move(task);
+        CHECK(shared.use_count() == 2);
+        other();
+    }
+    CHECK(shared.use_count() == 1);
+    CHECK(*shared == 1);
+}
+
+TEST_CASE("test_fifo_of_move_only_tasks") {
+    Fifo<InlineTask<>, 2> fifo{};
+    int counter = 0;
+
+    CHECK(fifo.push(InlineTask<>([&counter] { counter += 1; })));
+    CHECK(fifo.push(InlineTask<>([&counter] { counter += 10; })));
+    CHECK_FALSE(fifo.push(InlineTask<>([&counter] { counter += 100; })));
+
+    InlineTask<> task{};
+    while (fifo.pop(&task)) {
+        task();
+    }
+    CHECK(counter == 11);
+}
+
+TEST_CASE("test_thread_pool_submit") {
+    static constexpr size_t NB_TASKS{10000U};
+    std::atomic<size_t> counter{0U};
+    ThreadPool<64> pool(4);
+
+    for (size_t i = 0; i < NB_TASKS; i++) {
+        while (!pool.submit([&counter] { counter.fetch_add(1); })) {
+            std::this_thread::yield();
+        }
+    }
+
+    pool.waitIdle();
+    CHECK(counter.load() == NB_TASKS);
+}
+
+TEST_CASE("test_thread_pool_full_queue_retry") {
+    using Pool = ThreadPool<2>;
+    std::atomic<bool> started{false};
+    std::atomic<bool> release{false};
+    int result = 0;
+    Pool pool(1);
+
+    CHECK_FALSE(pool.submit(Pool::Task{}));
+
+    // Block the only worker, then fill its queue
+    CHECK(pool.submit([&started, &release] {
+        started.store(true);
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+    }));
+    while (!started.load()) {
+        std::this_thread::yield();
+    }
+    CHECK(pool.submit([] {}));
+    CHECK(pool.submit([] {}));
+
+    struct MoveOnlyTask {
+        std::unique_ptr<int> value;
+        int *result;
+        void operator()() { *result = *value; }
+    } task{std::make_unique<int>(7), &result};
+
+    CHECK_FALSE(pool.submit(std::move(task)));
+    CHECK_MESSAGE(task.value != nullptr, "A rejected callable is left as is");
+
+    release.store(true);
+    pool.waitIdle();
+    CHECK(pool.submit(std::move(task)));
+    pool.waitIdle();
+    CHECK(result == 7);
+}
+
+TEST_CASE("test_thread_pool_bulk_submit") {
+    using Pool = ThreadPool<16>;
+    std::atomic<size_t> sum{0U};
+    Pool pool(2);
+
+    std::vector<Pool::Task> tasks;
+    for (size_t i = 1; i <= 20; i++) {
+        tasks.emplace_back([&sum, i] { sum.fetch_add(i); });
+    }
+
+    size_t submitted = 0U;
+    while (submitted < tasks.size()) {
+        submitted += pool.submit(std::span<Pool::Task>{tasks}.subspan(submitted));
+    }
+
+    pool.waitIdle();
+    CHECK(sum.load() == 210);
+    CHECK_FALSE(static_cast<bool>(tasks[0]));
+}
+
+TEST_CASE("test_thread_pool_bulk_submit_wakes_workers") {
+    using Pool = ThreadPool<4>;
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    Pool pool(2);
+
+    // Let both workers go to sleep
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    std::vector<Pool::Task> tasks;
+    for (size_t i = 0; i < 8; i++) {
+        tasks.emplace_back([&mutex, &threads] {
+            {
+                std::lock_guard lock(mutex);
+                threads.insert(std::this_thread::get_id());
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        });
+    }
+
+    CHECK(pool.submit(std::span<Pool::Task>{tasks}) == 8);
+    pool.waitIdle();
+    CHECK_MESSAGE(threads.size() == 2, "Each queue filled by the bulk submit wakes its worker");
+}
+
+TEST_CASE("test_thread_pool_drains_on_destruction") {
+    std::atomic<size_t> counter{0U};
+    {
+        ThreadPool<32> pool(1);
+        for (size_t i = 0; i < 32; i++) {
+            pool.submit([&counter] { counter.fetch_add(1); });
+        }
+    }
+    CHECK(counter.load() == 32);
+}